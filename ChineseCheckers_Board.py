@@ -160,6 +160,9 @@ class BoardArea(Areas):
 
 
     def reset(self,playerW : Player,playerB : Player):
+        # The previous players do not search anymore
+        self.playerW.stopPondering()
+        self.playerB.stopPondering()
         self.playerW = playerW
         self.playerB = playerB
         self.whoistoplay = self.playerW
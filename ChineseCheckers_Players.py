@@ -20,6 +20,9 @@ class Player():
     def getMove(self):
         return([])
     
+    def stopPondering(self):
+        pass
+    
     
 
 class Human(Player):
@@ -27,14 +30,36 @@ class Human(Player):
         super().__init__(True)
 
 class AI_cpp(Player):
-    def __init__(self,depth = 3):
+    def __init__(self,depth = 3,threads = 1,time_ms = None,ponder = False):
         assert(depth >= 0)
+        assert(threads >= 1)
+        assert(time_ms is None or time_ms > 0)
         super().__init__(False)
         self.__solver = ab.Solver()
+        self.__solver.setNumberOfThreads(threads)
         self.depth = depth
+        self.time_ms = time_ms
+        # Search on the opponent's time
+        self.ponder = ponder
+        self.__own_move_pending = False
         
     def applyMove(self,intwhoistoplay : int,move : list):
         self.__solver.move(intwhoistoplay,move)
+        # Nothing is left to ponder once the game is over
+        if self.__solver.state_of_game() != ab.Result.NotFinished:
+            self.__own_move_pending = False
+            self.__solver.stopPondering()
+        # The move returned by getMove has been played: the opponent is thinking
+        elif self.__own_move_pending:
+            self.__own_move_pending = False
+            self.__solver.startPondering()
+    
+    def stopPondering(self):
+        self.__solver.stopPondering()
     
     def getMove(self):
+        # The next search stops the pondering itself and continues from it if the expected reply was played
+        self.__own_move_pending = self.ponder
+        if self.time_ms is not None:
+            return(self.__solver.getMoveWithin(self.time_ms))
         return(self.__solver.getMove(self.depth,-100000,100000))
\ No newline at end of file
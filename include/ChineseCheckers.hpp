@@ -21,6 +21,7 @@
 #include <iostream>
 #include <utility>
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <boost/unordered_map.hpp>
 /* The following pragma are used to removed depraction warning from boost
@@ -33,6 +34,10 @@
 
 /* Other */
 #include "Types.hpp"
+#include "Geometry.hpp"
+#include "IllegalPositions.hpp"
+#include "ZobristKeys.hpp"
+#include "SharedContext.hpp"
 
 /*!
  * @class ChineseCheckers
@@ -53,43 +58,86 @@ class ChineseCheckers {
     bitBoards_t bit_boards_;
     /*! @details The hash of the current grid. */
     uint_fast64_t  zobrist_hash_;
-    /*! @details Zobrist keys associated with each positions. */
-    std::array<boost::unordered_map<uint_fast64_t, uint_fast64_t>, 2> zobrist_keys_;
-    /*! @details Zobrist keys associated to a move. */
-    std::array<boost::unordered_map<uint_fast64_t, uint_fast64_t>, 2> zobrist_keys_moves_;
+    /*! @details The Zobrist keys. By default, they are the ones of the @ref SharedContext. */
+    std::shared_ptr<const ZobristKeys> zobrist_keys_;
     /*! @details
-     * Indicates the number of times a position has been seen.
+     * The hashes of the positions of the game, indexed by ply: positions_seen_[0] is the initial
+     * position and the last one is the current position. The solvers push the positions they search on top of it.
+     * The same player is to play in positions_seen_[i] and positions_seen_[i + 2].
      * It is used to check for draws.
-     * */
-    boost::unordered_map<uint64_t , int> number_of_times_seen_;
-    /*! @details Indicate the positions we have already seen. */
+     */
     std::vector<uint64_t> positions_seen_;
+    /*! @details
+     * A direct-mapped filter over @ref positions_seen_: each slot counts the positions
+     * whose hash falls in it. A position whose slot counts only itself has not been repeated,
+     * which avoids to scan @ref positions_seen_ most of the time.
+     */
+    std::array<uint16_t, REPETITION_FILTER_SIZE> repetition_filter_ = {};
     /*! @details Keeps the positions of the white winning zone. */
     const uint_fast64_t winning_positions_white_ = 0xF0E0C08000000000;
     /*! @details Keeps the positions of the black winning zone. */
     const uint_fast64_t winning_positions_black_ = 0x000000000103070F;
-    /*! @details Stores the illegal positions. */
-    const boost::unordered_map<uint32_t, bool> illegal_positions_;
+    /*! @details Stores the illegal positions. It is the one of the @ref SharedContext. */
+    const std::shared_ptr<const IllegalPositions> illegal_positions_;
     /*! @details Stores results of cantor pairing to make the check for illegal positions faster. */
-    const std::array<std::array<uint32_t, 8>, 8> cantor_pairing_;
+    static constexpr std::array<std::array<uint32_t, 8>, 8> cantor_pairing_ = initCantorPairing();
     /*! @details Stores the valid directions to find if a move is valid faster. */
-    const std::vector<std::vector<int>> valid_lines = {{-1,  0}, {-1,  1}, {0 , -1},
-                                                 {0 ,  1}, {1 , -1}, {1 ,  0}};
+    static constexpr std::array<std::array<int, 2>, NUMBER_OF_DIRECTIONS> valid_lines = initValidLines();
     /*! @details Stores the valid directions to find if a position is legal faster. */
-    const std::vector<std::vector<int>> valid_lines_illegal = {{-1,  0}, {-1,  1}, {0 , -1},
-                                                         {0 ,  1}, {1 , -1}, {1 ,  0},
-                                                         {-2,  0}, {-2,  2}, {0 , -2},
-                                                         {0 ,  2}, {2 , -2}, {2 ,  0}};
+    static constexpr std::array<std::array<int, 2>, 2 * NUMBER_OF_DIRECTIONS> valid_lines_illegal =
+                                                        {{{-1,  0}, {-1,  1}, {0 , -1},
+                                                          {0 ,  1}, {1 , -1}, {1 ,  0},
+                                                          {-2,  0}, {-2,  2}, {0 , -2},
+                                                          {0 ,  2}, {2 , -2}, {2 ,  0}}};
     /*! @details Stores the conversion of a bit-wise position to a pair of index. */
-    const std::array<std::pair<int, int>, 64> uint64_to_pair_;
+    static constexpr std::array<std::pair<int, int>, 64> uint64_to_pair_ = initUint64ToPair();
     /*! @details Stores the conversion of a pair of index to a bit-wise position. */
-    const std::array<std::array<uint_fast64_t, 8>, 8> int_to_uint64_;
-    /*! @details Stores the neighbours' position of all pawns. */
-    const std::array<std::vector<uint_fast64_t>, 64> direct_neighbours_;
-    /*! @detailsStores all required bitMasks to find all jumps from a given pawn. */
-    const std::array<std::vector<
-        std::vector<std::pair<std::pair<uint_fast64_t,
-        uint_fast64_t>, uint_fast64_t> > >, 64> k_neighbours_;
+    static constexpr std::array<std::array<uint_fast64_t, 8>, 8> int_to_uint64_ = initIntToUint64();
+    /*! @details Stores, for each square, the bitboard of its neighbours. */
+    static constexpr std::array<uint_fast64_t, 64> direct_neighbours_ = initDirectNeighbours();
+    /*!
+     * @details
+     * Stores all required bitMasks to find all jumps from a given pawn:
+     * k_neighbours_[square][direction] lists the jumps from the closest to the farthest pivot.
+     */
+    static constexpr std::array<std::array<std::array<JumpEntry, MAX_JUMP_DISTANCE>, NUMBER_OF_DIRECTIONS>, 64>
+                                                                                k_neighbours_ = initKNeighbours();
+    /*! @details Stores the offset of the index of a square when moving one step in each direction. */
+    static constexpr std::array<int, NUMBER_OF_DIRECTIONS> direction_offsets_ = initDirectionOffsets();
+    /*!
+     * @details
+     * Stores, for each direction and each number of steps, the squares that stay on the board.
+     * It is used to shift whole bitboards (see @ref shiftBitBoard).
+     */
+    static constexpr std::array<std::array<uint_fast64_t, 2 * MAX_JUMP_DISTANCE + 1>, NUMBER_OF_DIRECTIONS>
+                                                                                shift_masks_ = initShiftMasks();
+
+    /*!
+     * @details Moves all the pawns of a bitboard a given number of steps in a direction.
+     * The pawns that would leave the board are removed.
+     * @param bb The bitboard.
+     * @param direction The index of the direction in @ref valid_lines.
+     * @param steps The number of steps, at most 2 * MAX_JUMP_DISTANCE.
+     * @return The shifted bitboard.
+     * @sa shiftBitBoardBack
+     */
+    static inline uint_fast64_t shiftBitBoard(const uint_fast64_t &bb, const int &direction, const int &steps) {
+        const int shift = direction_offsets_[direction] * steps;
+        const uint_fast64_t movable = bb & shift_masks_[direction][steps];
+        return shift > 0 ? movable << shift : movable >> -shift;
+    }
+    /*!
+     * @details Returns the squares from which moving a given number of steps in a direction reaches a square of a bitboard.
+     * @param bb The bitboard.
+     * @param direction The index of the direction in @ref valid_lines.
+     * @param steps The number of steps, at most 2 * MAX_JUMP_DISTANCE.
+     * @return The bitboard of those squares.
+     * @sa shiftBitBoard
+     */
+    static inline uint_fast64_t shiftBitBoardBack(const uint_fast64_t &bb, const int &direction, const int &steps) {
+        const int shift = direction_offsets_[direction] * steps;
+        return (shift > 0 ? bb >> shift : bb << -shift) & shift_masks_[direction][steps];
+    }
 
     /*! @details
      * A member returning the type of an elementary move
@@ -107,7 +155,7 @@ class ChineseCheckers {
      * @details Indicates whether the position is illegal or not.
      * @return Returns true iff the position is illegal.
      * @sa cantorPairingFunction
-     * @sa loadIllegalPositions
+     * @sa IllegalPositions
      */
     bool isPositionIllegal() const;
 
@@ -117,29 +165,64 @@ class ChineseCheckers {
      * @param y second argument.
      * @return cantor's pairing function applied to `x` and `y`.
      * @sa isPositionIllegal
-     * @sa loadIllegalPositions
+     * @sa IllegalPositions
      */
     int cantorPairingFunction(const int &x, const int &y) const;
 
     /*!
-     * @details Loads illegal positions.
-     * @sa isPositionIllegal
-     * @sa cantorPairingFunction
-     */
-    boost::unordered_map<uint32_t, bool> loadIllegalPositions() const;
-    /*!
-     * @details Generates @ref zobrist_keys_.
-     * @sa computeAndSetZobristHash
+     * @details
+     * Returns the value xored into the hash by a move: the keys of its two squares for the player moving
+     * and the key of the side to move, which changes.
+     * @param player The player moving.
+     * @param move The move. Only two bits must be set : the original position and the arrival position.
+     * @return The Zobrist key of the move.
      */
-    void generateZobristKeys();
+    inline uint64_t zobristMoveKey(const Player &player, const uint_fast64_t &move) const {
+        return zobrist_keys_->squares[player][__builtin_ctzll(move)]
+             ^ zobrist_keys_->squares[player][63 - __builtin_clzll(move)]
+             ^ zobrist_keys_->black_to_play;
+    }
     /*!
      * @details
      * The function calculates the Zobrist hash value for the current game state based
      * on the position of each piece on the board, using precomputed random keys for each
      * square and each color. The hash value is stored in the @ref zobrist_hash_ member variable.
-     * @sa generateZobristKeys
+     * @sa setZobristSeed
      */
     void computeAndSetZobristHash();
+
+    /*!
+     * @details Pushes a position on top of @ref positions_seen_.
+     * @param hash The hash of the position.
+     * @sa popPosition
+     */
+    inline void pushPosition(const uint64_t &hash) {
+        positions_seen_.push_back(hash);
+        ++repetition_filter_[hash & (REPETITION_FILTER_SIZE - 1)];
+    }
+    /*!
+     * @details Removes the position on top of @ref positions_seen_.
+     * @sa pushPosition
+     */
+    inline void popPosition() {
+        --repetition_filter_[positions_seen_.back() & (REPETITION_FILTER_SIZE - 1)];
+        positions_seen_.pop_back();
+    }
+    /*!
+     * @details
+     * Indicates if the position on top of @ref positions_seen_ has already been seen with the same player to play.
+     * No move is irreversible in this game so the whole history may have to be scanned, but
+     * @ref repetition_filter_ avoids it unless the position is likely to be a repetition.
+     * @return True iff the position is a repetition.
+     * @sa numberOfTimesSeen
+     */
+    bool isRepetition() const;
+    /*!
+     * @details Counts the number of times the position on top of @ref positions_seen_ has been seen.
+     * @return The number of times the position has been seen with the same player to play, including this time.
+     * @sa isRepetition
+     */
+    int numberOfTimesSeen() const;
  public:
     /*! @details
      * Construct the object
@@ -150,6 +233,13 @@ class ChineseCheckers {
     * Creates a new game.
     */
     void newGame();
+    /*! @details
+     * Generates new Zobrist keys from a seed. The keys are generated from @ref ZOBRIST_SEED by default.
+     * The hash of the current position is recomputed and the history of the game restarts from it,
+     * so it should be called before the game starts.
+     * @param seed The seed of the Zobrist keys.
+     */
+    void setZobristSeed(const uint64_t &seed);
 
     /*! @details
      * This member checks if a move is legal and executes it if it is legal.
@@ -185,6 +275,29 @@ class ChineseCheckers {
      * @sa move
      */
     void moveWithoutVerification(const uint_fast64_t &move);
+    /*!
+     * @details
+     * This function undoes a move played with @ref moveWithoutVerification.
+     * It must be the last move played.
+     * @param move indicates the move to undo. This is a 64 bit type. Only two bits must be set : the original
+     * position and the arrival position.
+     * @sa moveWithoutVerification
+     */
+    void undoMoveWithoutVerification(const uint_fast64_t &move);
+
+    /*! @details
+     * Returns the current state of the game as a value.
+     * @return The grid, the player to play and @ref positions_seen_.
+     * @sa setPosition
+     */
+    Position getPosition() const;
+    /*! @details
+     * Sets the current state of the game. The history of the position must have been computed with the same
+     * Zobrist keys. If it is empty, the history restarts from the position.
+     * @param position The position.
+     * @sa getPosition
+     */
+    void setPosition(const Position &position);
 
     /*! @details
      * Returns @ref who_is_to_play_
@@ -201,6 +314,12 @@ class ChineseCheckers {
      * @return @ref bit_boards_.Black
      */
     uint_fast64_t getBitBoardBlack() const;
+    /*! @details
+     * Returns @ref zobrist_hash_. With the same seed, a position always has the same hash.
+     * @return @ref zobrist_hash_
+     * @sa setZobristSeed
+     */
+    uint64_t getZobristHash() const;
 
     /*! @details Prints the grid. */
     void printGrid() const ;
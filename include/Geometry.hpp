@@ -0,0 +1,196 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * @file Geometry.hpp
+ * @brief Geometry of the board
+ *
+ * Compile-time generation of the tables describing the board: conversions between the
+ * coordinates and the bitboards, the neighbours of each square and the possible jumps.
+ * The tables are computed by the compiler and stored in read-only memory shared by all the instances.
+ *
+ */
+
+#ifndef INCLUDE_GEOMETRY_HPP_
+#define INCLUDE_GEOMETRY_HPP_
+
+/* C Libraries */
+#include <stdint.h>
+
+/* C++ libraries */
+#include <array>
+#include <utility>
+
+/* The number of directions a pawn can move in. */
+#define NUMBER_OF_DIRECTIONS 6
+/* The maximum distance of the pawn jumped over: a jump over a pawn at distance k lands at distance 2k < 8. */
+#define MAX_JUMP_DISTANCE 3
+
+/*! @brief A possible jump from a square in a given direction. */
+struct JumpEntry {
+    /*! @details The square of the pawn jumped over. 0 marks the end of the jumps of a direction. */
+    uint_fast64_t pivot;
+    /*! @details The square the pawn lands on. */
+    uint_fast64_t landing;
+    /*! @details The squares that must be empty for the jump to be valid, including @ref landing. */
+    uint_fast64_t line;
+};
+
+/*!
+ * @details Returns the directions a pawn can move in.
+ * @return The (row, column) step of each direction.
+ */
+constexpr std::array<std::array<int, 2>, NUMBER_OF_DIRECTIONS> initValidLines() {
+    return {{{-1,  0}, {-1,  1}, {0 , -1},
+             {0 ,  1}, {1 , -1}, {1 ,  0}}};
+}
+
+/*!
+ * @details Computes the conversion of a bit-wise position to a pair of index.
+ * @return The coordinates of each square.
+ */
+constexpr std::array<std::pair<int, int>, 64> initUint64ToPair() {
+    std::array<std::pair<int, int>, 64> result = {};
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j)
+            result[(i * 8) + j] = {i, j};
+    }
+    return result;
+}
+
+/*!
+ * @details
+ * Computes the results of cantor pairing used to check for illegal positions.
+ * Only the squares of the starting zones have a pairing lower than 32, the other ones get no bit.
+ * @return The bit associated with each square.
+ */
+constexpr std::array<std::array<uint32_t, 8>, 8> initCantorPairing() {
+    std::array<std::array<uint32_t, 8>, 8> result = {};
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            const int pairing = (i + j) * (i + j + 1) / 2 + i;
+            result[i][j] = pairing < 32 ? static_cast<uint32_t>(1) << pairing : 0;
+        }
+    }
+    return result;
+}
+
+/*!
+ * @details Computes the conversion of a pair of index to a bit-wise position.
+ * @return The bitboard of each square.
+ */
+constexpr std::array<std::array<uint_fast64_t, 8>, 8> initIntToUint64() {
+    std::array<std::array<uint_fast64_t, 8>, 8> result = {};
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j)
+            result[i][j] = static_cast<uint_fast64_t>(1) << ((i * 8) + j);
+    }
+    return result;
+}
+
+/*!
+ * @details Computes the neighbours of each square.
+ * @return For each square, the bitboard of its neighbours.
+ */
+constexpr std::array<uint_fast64_t, 64> initDirectNeighbours() {
+    std::array<uint_fast64_t, 64> result = {};
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            for (const auto &direction : initValidLines()) {
+                if (i + direction[0] >= 0
+                    && j + direction[1] >= 0
+                    && i + direction[0] < 8
+                    && j + direction[1] < 8) {
+                    result[8*i + j] |= static_cast<uint_fast64_t>(1) << (8 * (i + direction[0]) + j + direction[1]);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+/*!
+ * @details Computes the offset of the index of a square when moving one step in each direction.
+ * @return The offset of each direction.
+ */
+constexpr std::array<int, NUMBER_OF_DIRECTIONS> initDirectionOffsets() {
+    std::array<int, NUMBER_OF_DIRECTIONS> result = {};
+    for (int dir = 0; dir < NUMBER_OF_DIRECTIONS; ++dir)
+        result[dir] = 8 * initValidLines()[dir][0] + initValidLines()[dir][1];
+    return result;
+}
+
+/*!
+ * @details
+ * Computes the squares that stay on the board when moving a given number of steps in each direction.
+ * Shifting a whole bitboard by steps * offset and masking it with this table moves all its pawns at once
+ * without letting them wrap around the edges of the board.
+ * Jumps over a pawn at distance k cover 2k steps, hence the 2 * MAX_JUMP_DISTANCE steps.
+ * @return For each direction and each number of steps, the bitboard of the squares that can move.
+ */
+constexpr std::array<std::array<uint_fast64_t, 2 * MAX_JUMP_DISTANCE + 1>, NUMBER_OF_DIRECTIONS> initShiftMasks() {
+    std::array<std::array<uint_fast64_t, 2 * MAX_JUMP_DISTANCE + 1>, NUMBER_OF_DIRECTIONS> result = {};
+    for (int dir = 0; dir < NUMBER_OF_DIRECTIONS; ++dir) {
+        const int di = initValidLines()[dir][0];
+        const int dj = initValidLines()[dir][1];
+        for (int steps = 0; steps <= 2 * MAX_JUMP_DISTANCE; ++steps) {
+            for (int i = 0; i < 8; ++i) {
+                for (int j = 0; j < 8; ++j) {
+                    if (i + di * steps >= 0
+                        && j + dj * steps >= 0
+                        && i + di * steps < 8
+                        && j + dj * steps < 8)
+                        result[dir][steps] |= static_cast<uint_fast64_t>(1) << ((i * 8) + j);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+/*!
+ * @details
+ * Computes the jumps from each square in each direction, from the closest to the farthest pivot.
+ * A jump over a pawn at distance k lands at distance 2k and every other square in between must be empty.
+ * @return For each square and each direction, the possible jumps.
+ */
+constexpr std::array<std::array<std::array<JumpEntry, MAX_JUMP_DISTANCE>, NUMBER_OF_DIRECTIONS>, 64>
+initKNeighbours() {
+    std::array<std::array<std::array<JumpEntry, MAX_JUMP_DISTANCE>, NUMBER_OF_DIRECTIONS>, 64> result = {};
+    auto square = [](const int &i, const int &j) {
+        return static_cast<uint_fast64_t>(1) << ((i * 8) + j);
+    };
+
+    /* Loops over all positions of the board. */
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            /* Loop of all directions for a given position. */
+            for (int dir = 0; dir < NUMBER_OF_DIRECTIONS; ++dir) {
+                const int di = initValidLines()[dir][0];
+                const int dj = initValidLines()[dir][1];
+
+                /* Loop over all possible jump from a given position in a given direction. */
+                for (int k = 1;    i + di * (k << 1) < 8
+                                   && j + dj * (k << 1) < 8
+                                   && i + di * (k << 1) >= 0
+                                   && j + dj * (k << 1) >= 0; ++k) {
+                    uint_fast64_t line = square(i + di * (k << 1), j + dj * (k << 1));
+                    for (int l = 1; l < k; ++l) {
+                        line |= square(i + di * (k - l), j + dj * (k - l));
+                        line |= square(i + di * (k + l), j + dj * (k + l));
+                    }
+
+                    result[8*i + j][dir][k - 1] = {square(i + di * k, j + dj * k),
+                                                   square(i + di * (k << 1), j + dj * (k << 1)),
+                                                   line};
+                }
+            }
+        }
+    }
+    return result;
+}
+
+#endif  // INCLUDE_GEOMETRY_HPP_
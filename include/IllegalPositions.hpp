@@ -0,0 +1,100 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * @file IllegalPositions.hpp
+ * @brief Illegal positions declaration.
+ *
+ * Declaration of the IllegalPositions Class which stores the codes of the illegal positions in a bitset.
+ *
+ */
+
+#ifndef INCLUDE_ILLEGALPOSITIONS_HPP_
+#define INCLUDE_ILLEGALPOSITIONS_HPP_
+
+/* C Libraries */
+#include <stdint.h>
+
+/* C++ libraries */
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/* The number of bits of the codes of the illegal positions (see ChineseCheckers::isPositionIllegal). */
+#define ILLEGAL_POSITIONS_CODE_BITS (22)
+/* The number of 64 bits words of the bitset. */
+#define ILLEGAL_POSITIONS_WORDS ((static_cast<uint32_t>(1) << ILLEGAL_POSITIONS_CODE_BITS) >> 6)
+/* The text file listing the codes of the illegal positions in hexadecimal, one per line. */
+#define ILLEGAL_POSITIONS_TEXT_FILE "./raw_data/illegal_moves.dat"
+/* The bitset built from ILLEGAL_POSITIONS_TEXT_FILE by Illegal_positions_packer. */
+#define ILLEGAL_POSITIONS_BINARY_FILE "./raw_data/illegal_positions.bin"
+
+/*!
+ * @brief
+ * The IllegalPositions class is the set of the codes of the illegal positions.
+ * The codes fit in @ref ILLEGAL_POSITIONS_CODE_BITS bits so the set is stored as a bitset of 512 KB
+ * and a lookup is a single bit test.
+ *
+ * The bitset is read from @ref ILLEGAL_POSITIONS_BINARY_FILE, which is mapped in memory: loading it is
+ * almost free and its pages are shared by all the processes using it. If this file is missing,
+ * the bitset is built from @ref ILLEGAL_POSITIONS_TEXT_FILE.
+ */
+class IllegalPositions {
+ private:
+    /*! @details The bitset. It points either to the mapped file or to @ref bits_storage_. */
+    const uint64_t *bits_ = nullptr;
+    /*! @details The bitset when it is built from the text file. */
+    std::vector<uint64_t> bits_storage_;
+    /*! @details The mapped file (nullptr if the file is not mapped). */
+    void *mapping_ = nullptr;
+
+    /*!
+     * @details Maps a binary file built by @ref saveBinary.
+     * @param file_name The file.
+     * @return True iff the file was mapped.
+     */
+    bool mapBinary(const std::string &file_name);
+    /*!
+     * @details Builds the bitset from a text file listing a code in hexadecimal on each line.
+     * @param file_name The file.
+     */
+    void loadText(const std::string &file_name);
+
+ public:
+    /*!
+     * @details Loads the bitset, from the binary file if possible and from the text file otherwise.
+     * @param binary_file_name The binary file.
+     * @param text_file_name The text file.
+     */
+    explicit IllegalPositions(const std::string &binary_file_name = ILLEGAL_POSITIONS_BINARY_FILE,
+                              const std::string &text_file_name = ILLEGAL_POSITIONS_TEXT_FILE);
+    /*! @details Unmaps the binary file. */
+    ~IllegalPositions();
+    IllegalPositions(const IllegalPositions &) = delete;
+    IllegalPositions &operator=(const IllegalPositions &) = delete;
+
+    /*!
+     * @details Indicates if a code is the code of an illegal position.
+     * @param code The code.
+     * @return True iff the code is in the set.
+     */
+    inline bool contains(const uint32_t &code) const {
+        return !(code >> ILLEGAL_POSITIONS_CODE_BITS) && ((bits_[code >> 6] >> (code & 63)) & 1);
+    }
+    /*!
+     * @details Indicates if the bitset was read from the binary file.
+     * @return True iff the binary file is mapped.
+     */
+    bool isMapped() const;
+    /*!
+     * @details Writes the bitset in a binary file that can be mapped later.
+     * @param file_name The file.
+     * @return True iff the file was written.
+     */
+    bool saveBinary(const std::string &file_name) const;
+};
+
+#endif  // INCLUDE_ILLEGALPOSITIONS_HPP_
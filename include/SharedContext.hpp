@@ -0,0 +1,67 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * @file SharedContext.hpp
+ * @brief Shared context declaration.
+ *
+ * Declaration of the SharedContext Class which stores the immutable data shared by all the games of a process.
+ *
+ */
+
+#ifndef INCLUDE_SHAREDCONTEXT_HPP_
+#define INCLUDE_SHAREDCONTEXT_HPP_
+
+/* C++ libraries */
+#include <memory>
+
+/* Other */
+#include "IllegalPositions.hpp"
+#include "ZobristKeys.hpp"
+
+/*!
+ * @brief
+ * The SharedContext class stores the immutable data needed by every game: the illegal positions and
+ * the Zobrist keys generated from @ref ZOBRIST_SEED. The geometry of the board is computed at compile time
+ * (see Geometry.hpp) and does not need to be stored here.
+ *
+ * There is a single context per process. It is built by the first call to @ref get, which is thread-safe,
+ * and the games only keep pointers to its data: constructing or copying a game loads nothing and
+ * the memory used does not grow with the number of games or threads.
+ */
+class SharedContext {
+ private:
+    /*! @details The illegal positions. */
+    const std::shared_ptr<const IllegalPositions> illegal_positions_;
+    /*! @details The Zobrist keys generated from @ref ZOBRIST_SEED. */
+    const std::shared_ptr<const ZobristKeys> zobrist_keys_;
+
+    /*! @details Loads the data. It is only called by @ref get. */
+    SharedContext();
+
+ public:
+    SharedContext(const SharedContext &) = delete;
+    SharedContext &operator=(const SharedContext &) = delete;
+
+    /*!
+     * @details Returns the context of the process. It is built by the first call.
+     * @return The context.
+     */
+    static const SharedContext &get();
+
+    /*!
+     * @details Returns @ref illegal_positions_.
+     * @return @ref illegal_positions_.
+     */
+    const std::shared_ptr<const IllegalPositions> &getIllegalPositions() const;
+    /*!
+     * @details Returns @ref zobrist_keys_.
+     * @return @ref zobrist_keys_.
+     */
+    const std::shared_ptr<const ZobristKeys> &getZobristKeys() const;
+};
+
+#endif  // INCLUDE_SHAREDCONTEXT_HPP_
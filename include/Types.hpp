@@ -20,6 +20,10 @@
 
 /* The number of time a grid state can be seen before settling for a draw */
 #define MAX_NUMBER_OF_CYCLES_FOR_DRAW_ 3
+/* The number of slots of the repetition filter. It must be a power of 2. */
+#define REPETITION_FILTER_SIZE 4096
+/* The default seed of the Zobrist keys. A fixed seed gives the same hashes in every run and every process. */
+#define ZOBRIST_SEED 0x9E3779B97F4A7C15
 
 /*! \cond DO_NOT_DOCUMENT */
 struct bitBoards_s {
@@ -76,6 +80,20 @@ typedef std::vector<PositionType> ListOfPositionType;
  */
 typedef std::vector<ListOfPositionType> ListOfMoves;
 
+/*! \struct Position
+    \brief A state of a game: the grid, the player to play and the history used to detect the draws.
+    It is a value: it can be copied and searched without an engine (see AlphaBeta::search).
+    Not to be confused with PositionType, which is a square of the grid.
+ */
+struct Position {
+    /*! \brief The grid. */
+    bitBoards_t bit_boards;
+    /*! \brief The player to play. */
+    Player who_is_to_play = 0;
+    /*! \brief The hashes of the positions of the game, the last one being this position. */
+    std::vector<uint64_t> history;
+};
+
 
 
 
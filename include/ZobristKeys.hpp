@@ -0,0 +1,43 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * @file ZobristKeys.hpp
+ * @brief Zobrist keys declaration.
+ *
+ * Declaration of the ZobristKeys structure which stores the random keys used to hash the positions.
+ *
+ */
+
+#ifndef INCLUDE_ZOBRISTKEYS_HPP_
+#define INCLUDE_ZOBRISTKEYS_HPP_
+
+/* C Libraries */
+#include <stdint.h>
+
+/* C++ libraries */
+#include <array>
+
+/*!
+ * @brief
+ * The ZobristKeys structure stores the keys used to hash the positions.
+ * The hash of a position is the xor of the keys of its pawns and of @ref black_to_play when Black is to play.
+ * The keys only depend on the seed they are generated from, so that a position has the same hash in every process.
+ */
+struct ZobristKeys {
+    /*! @details The key of each square, for each player. They are indexed by the index of the square. */
+    std::array<std::array<uint64_t, 64>, 2> squares;
+    /*! @details The key xored into the hash when Black is to play. */
+    uint64_t black_to_play;
+
+    /*!
+     * @details Generates the keys.
+     * @param seed The seed of the random number generator. The same seed always gives the same keys.
+     */
+    explicit ZobristKeys(const uint64_t &seed);
+};
+
+#endif  // INCLUDE_ZOBRISTKEYS_HPP_
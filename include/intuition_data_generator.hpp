@@ -41,6 +41,7 @@ class IntuitionDataGenerator : public AlphaBeta {
  public:
     /*!
      * @details this function is used to eval all possible moves.
+     * They are all scored by a single search (see @ref multiPVSearch).
      * @param depth The depth used by the alpha beta algorithm.
      * @return The evaluation associated with each move and the grid obtained after each move.
      */
@@ -35,6 +35,9 @@
  */
 class OpeningsGenerator : public AlphaBeta {
  private:
+    /*! @details The openings being generated. It starts with the openings already in the files. */
+    std::shared_ptr<openings_t> openings_ = loadOpenings();
+
  public:
     /*!
      * @details Generates the openings up to a given depth.
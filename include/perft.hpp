@@ -0,0 +1,47 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * @file perft.hpp
+ * @brief
+ *
+ * This class is used to check and to time the move generation
+ *
+ */
+
+#ifndef INCLUDE_PERFT_HPP_
+#define INCLUDE_PERFT_HPP_
+
+/* C libraries */
+#include <stdint.h>
+
+/* Other */
+#include "Types.hpp"
+#include "AlphaBeta.hpp"
+
+/*!
+ * @brief
+ * This class is used to run @ref AlphaBeta::perft from any position and to report the number of nodes per second.
+ */
+class Perft : public AlphaBeta {
+ public:
+    /*!
+     * @details Sets the position to count the moves from.
+     * @param bb The bit boards of the position.
+     * @param player The player who is to play.
+     */
+    void setPosition(const bitBoards_t &bb, const Player &player);
+
+    /*!
+     * @details Runs @ref AlphaBeta::perft and prints the number of positions and the number of nodes per second.
+     * @param depth The number of moves.
+     * @param divide Indicates if the count must be printed for each move of the current position.
+     */
+    void run(const int &depth, const bool &divide);
+};
+
+
+#endif  // INCLUDE_PERFT_HPP_
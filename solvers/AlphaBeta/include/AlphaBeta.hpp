@@ -26,12 +26,168 @@
 #include <map>
 #include <set>
 #include <vector>
+#include <memory>
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
 #include <unordered_map>
 #include <boost/unordered_map.hpp>
 
 /* Other */
 #include "Types.hpp"
 #include "ChineseCheckers.hpp"
+#include "TranspositionTable.hpp"
+#include "MoveList.hpp"
+#include "SearchStatistics.hpp"
+#include "WorkStealingQueues.hpp"
+#include "Score.hpp"
+
+/* Maximum depth of a search. */
+#define MAX_SEARCH_DEPTH (64)
+/* Number of killer moves kept for each ply. */
+#define NUMBER_OF_KILLER_MOVES (2)
+/* Default maximum number of moves searched at each node. Set -1 to search them all:
+ * the late move reductions make the late moves cheap to search. */
+#define MAX_TREE_WIDTH (-1)
+/* The late move reductions are given for the LMR_TABLE_SIZE first moves. The next ones get the last reduction. */
+#define LMR_TABLE_SIZE (64)
+/* Default parameters of the late move reductions (see AlphaBeta::setLateMoveReductionTable). */
+#define LMR_MIN_DEPTH (3)
+#define LMR_FULL_DEPTH_MOVES (3)
+#define LMR_BASE (0.5)
+#define LMR_DIVISOR (2.0)
+/* Default maximum number of jumps added after a leaf of the main search by the quiescence search. */
+#define QUIESCENCE_MAX_DEPTH (2)
+/* Default minimum progress of a jump searched by the quiescence search, in units of player_to_win_value_. */
+#define QUIESCENCE_MARGIN (0.5)
+/* Default maximum length in plies of the wins looked for by the win solver. */
+#define WIN_SOLVER_MAX_PLIES (7)
+/* Maximum number of nodes visited by the win solver for a move. */
+#define WIN_SOLVER_MAX_NODES (1 << 20)
+/* Number of positions of the proof table of the win solver above which it is cleared. */
+#define PROOF_TABLE_SIZE (1 << 20)
+/* Minimum depth of the nodes whose moves are searched in parallel by the Young Brothers Wait search. */
+#define YBWC_MIN_SPLIT_DEPTH (3)
+
+/*! @details The openings of each player: the move to play in each position. */
+typedef std::array<boost::unordered_map<bitBoards_t, uint_fast64_t, bitBoardsHasher, bitBoardsEqual>, 2> openings_t;
+/*! @details The reduction of the depth of each move, indexed by the depth of the node and the index of the move. */
+typedef std::array<std::array<uint8_t, LMR_TABLE_SIZE>, MAX_SEARCH_DEPTH + 1> lmr_table_t;
+/*! @details The quantized weights of the pawns on each square (see AlphaBeta::quantizeWeights). */
+typedef std::array<score_t, 64> weights_t;
+/*! @details The summed weights of the pawns of each row of the board, indexed by the row and the byte of the row. */
+typedef std::array<std::array<score_t, 256>, 8> row_weights_t;
+
+/*! @details A move of the root scored by AlphaBeta::multiPVSearch. */
+struct RootMove {
+    /*! @details The move. */
+    uint_fast64_t move;
+    /*! @details The score of the position reached by the move. */
+    score_t value;
+    /*! @details Indicates if @ref value is exact. Otherwise, the move is not one of the best ones and it is at least that bad. */
+    bool exact;
+    /*! @details The principal variation starting with the move. It only contains the move if the value is not exact. */
+    std::vector<uint_fast64_t> pv;
+};
+
+/*! @details The limits of a search run by AlphaBeta::search. At least one of them must be set. */
+struct Limits {
+    /*! @details The maximum depth of the search. */
+    int depth = MAX_SEARCH_DEPTH;
+    /*! @details The time budget in milliseconds, -1 for a search at @ref depth without a time limit. */
+    int time_ms = -1;
+};
+
+/*! @details The result of a search run by AlphaBeta::search. */
+struct SearchResult {
+    /*! @details The best move. */
+    uint_fast64_t move = 0;
+    /*! @details The value of the position. The lower, the better for the player to play. */
+    double value = 0;
+    /*! @details The depth of the last completed iteration, 0 if the move comes from the win solver. */
+    int depth = 0;
+    /*! @details The statistics of the search. */
+    SearchStatistics statistics;
+};
+
+/*! @details What the win solver knows about a position (see AlphaBeta::solveWin). */
+struct ProofEntry {
+    /*! @details The attacker wins within this number of plies, 0 if it is unknown. */
+    uint8_t proven = 0;
+    /*! @details The attacker does not win within this number of plies, 0 if it is unknown. */
+    uint8_t disproven = 0;
+    /*! @details The first move of the win when it is proven and the attacker is to play. */
+    uint_fast64_t move = 0;
+};
+
+/*!
+ * @brief
+ * A node of the Young Brothers Wait search whose moves are searched in parallel (see AlphaBeta::splitSearch).
+ * It holds a copy of the position of the node since the threads searching its moves do not share their position.
+ */
+struct SplitPoint {
+    /*! @details The bit boards of the node. */
+    bitBoards_t bit_boards;
+    /*! @details The player to play in the node. */
+    Player who_is_to_play;
+    /*! @details The heuristic value of the node. */
+    score_t heuristic_value;
+    /*! @details The hash of the node. */
+    uint_fast64_t hash;
+    /*! @details The distance of the node from the root. */
+    int ply;
+    /*! @details The positions played to reach the node, used to find the repetitions. */
+    std::vector<uint64_t> positions_seen;
+    /*! @details The repetition filter of @ref positions_seen. */
+    std::array<uint16_t, REPETITION_FILTER_SIZE> repetition_filter;
+
+    /*! @details The depth of the node. */
+    int depth;
+    /*! @details Indicates if the node is a maximizing node. */
+    bool maximizing_player;
+    /*! @details Indicates if the moves of the node are reduced by the late move reductions. */
+    bool reduce;
+    /*! @details The split point whose move leads to this node, nullptr if there is none. */
+    const SplitPoint *parent;
+
+    /*! @details Protects @ref alpha, @ref beta, @ref value and @ref best_move. */
+    std::mutex mutex;
+    /*! @details The window of the node. It shrinks as the moves are searched. */
+    score_t alpha;
+    score_t beta;
+    /*! @details The value of the best move searched so far. */
+    score_t value;
+    /*! @details The best move searched so far. */
+    uint_fast64_t best_move;
+    /*! @details The number of moves which have not been searched yet. */
+    std::atomic<int> pending;
+    /*! @details Indicates that a move has caused a cut-off: the other moves do not need to be searched. */
+    std::atomic<bool> cutoff = false;
+
+    /*!
+     * @details Indicates if the search of the node is useless, i.e., if a cut-off happened in the node or above.
+     * @return True iff the search can be given up.
+     */
+    inline bool isCancelled() const {
+        for (const SplitPoint *split_point = this; split_point; split_point = split_point->parent) {
+            if (split_point->cutoff.load(std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+};
+
+/*! @details A move of a split point, searched by any of the threads of the Young Brothers Wait search. */
+struct SplitTask {
+    /*! @details The split point. */
+    SplitPoint *split_point;
+    /*! @details The move. */
+    uint_fast64_t move;
+    /*! @details The number of moves of the split point searched before this one, which gives its reduction. */
+    int index;
+};
 
 /*!
  * @brief
@@ -56,42 +212,183 @@ class AlphaBeta : public ChineseCheckers{
      * we are playing for.
      */
     std::vector<double> player_to_lose_value_;
+    /*! @details @ref player_to_win_value_ quantized. It is the one used by the search. */
+    weights_t player_to_win_score_;
+    /*! @details @ref player_to_lose_value_ quantized. It is the one used by the search. */
+    weights_t player_to_lose_score_;
+    /*!
+     * @details
+     * @ref player_to_win_score_ summed over the pawns of a row, for each player and seen from their perspective.
+     * They are computed by @ref computeRowWeights.
+     */
+    std::array<row_weights_t, 2> win_rows_;
+    /*!
+     * @details
+     * @ref player_to_lose_score_ summed over the pawns of a row, for each player and seen from their perspective.
+     * They are computed by @ref computeRowWeights.
+     */
+    std::array<row_weights_t, 2> lose_rows_;
 
     /*! @details Indicates which player we are playing for. */
     Player maximizing_player_;
     /*! @details Contains the best move we found so far. */
     uint_fast64_t best_move_;
 
-    /*! @details Transposition table used to store the results of previous searches. */
-    boost::unordered_map<uint_fast64_t, std::pair<double, int>> transposition_table_;
-    /*! @details Iterator used to find elements through the transposition table. */
-    boost::unordered_map<uint_fast64_t, std::pair<double, int>>::iterator it_transposition_table_;
-    /*! @details Map of pre-computed optimal openings. */
-    std::array<boost::unordered_map<bitBoards_t, uint_fast64_t , bitBoardsHasher, bitBoardsEqual>, 2> opening_;
-    /*! @details Tensorflow model used by @ref tensorflowOrderMoves. */
-    cppflow::model *model = new cppflow::model("model");
-    /*! @details Result of the evaluation of the moes from tensorFlow */
-    std::unordered_map<uint_fast64_t, double> result_tensorFlow_;
+    /*!
+     * @details
+     * Transposition table used to store the results of previous searches.
+     * It is kept from one search to another and shared with the helpers of the Lazy SMP search.
+     */
+    std::shared_ptr<TranspositionTable> transposition_table_ = std::make_shared<TranspositionTable>();
+    /*! @details Map of pre-computed optimal openings. The openings of the files are shared by all the engines. */
+    std::shared_ptr<const openings_t> opening_ = sharedOpenings();
+    /*! @details Indicates if the moves of the root are ordered by @ref tensorflowSortMoves. */
+    bool use_neural_network_ordering_ = false;
+    /*!
+     * @details
+     * Tensorflow model used by @ref tensorflowSortMoves. It is null until the ordering is enabled
+     * and it is then shared by all the engines of the process (see @ref sharedModel).
+     */
+    std::shared_ptr<cppflow::model> model_;
 
     /*! @details The current heuristic value. It avoids to compute it from scratch at each terminating node. */
-    double heuristic_value_;
+    score_t heuristic_value_;
     /*!@details The depth asked for. */
     int fullDepth_;
+
+    /*! @details The number of threads used by a search (see @ref setNumberOfThreads). */
+    int number_of_threads_ = 1;
+    /*! @details The engines used by the helper threads of the Lazy SMP search. */
+    std::vector<std::unique_ptr<AlphaBeta>> helpers_;
+    /*! @details The helper threads of the Lazy SMP search. */
+    std::vector<std::thread> helper_threads_;
+    /*!
+     * @details
+     * Indicates if the threads search the moves of the nodes in parallel with the Young Brothers Wait search
+     * instead of searching the whole tree with the Lazy SMP search (see @ref setYoungBrothersWait).
+     */
+    bool use_ybwc_ = false;
+    /*!
+     * @details
+     * The tasks of the Young Brothers Wait search, shared by all its threads.
+     * It is only set during a Young Brothers Wait search with more than one thread.
+     */
+    std::shared_ptr<WorkStealingQueues<SplitTask>> split_tasks_;
+    /*! @details The index of the queue of this engine in @ref split_tasks_. */
+    int split_index_ = 0;
+    /*! @details The split point of the task searched by this engine, nullptr if there is none. */
+    const SplitPoint *current_split_point_ = nullptr;
+    /*! @details The split point this engine is waiting for, nullptr if there is none. */
+    const SplitPoint *waiting_split_point_ = nullptr;
+    /*! @details The split point whose position is the current position, nullptr if it is unknown. */
+    const SplitPoint *position_split_point_ = nullptr;
+    /*!
+     * @details
+     * Indicates that the search must be stopped as soon as possible.
+     * It is shared with the helpers of the Lazy SMP search.
+     */
+    std::shared_ptr<std::atomic<bool>> stop_search_ = std::make_shared<std::atomic<bool>>(false);
+
+    /*! @details The number of nodes visited by the current search. */
+    uint64_t nodes_ = 0;
+    /*! @details The depth of the last iteration completed by the current search. */
+    int completed_depth_ = 0;
+    /*! @details The statistics of the current search. @ref nodes_ and @ref quiescence_nodes_ are kept apart. */
+    SearchStatistics statistics_;
+    /*! @details Indicates if the current search must be stopped at @ref deadline_. */
+    bool timed_search_ = false;
+    /*! @details The time at which a timed search must be stopped (see @ref getMoveWithin). */
+    std::chrono::steady_clock::time_point deadline_;
+
+    /*! @details Indicates if the killer moves and the history heuristic are used to order the moves. */
+    bool use_killers_and_history_ = true;
+    /*! @details The distance to the root of the node being searched. */
+    int ply_ = 0;
+    /*! @details For each ply, the last moves that produced a cut-off. They are searched first by the siblings. */
+    std::array<std::array<uint_fast64_t, NUMBER_OF_KILLER_MOVES>, MAX_SEARCH_DEPTH + 1> killer_moves_ = {};
+    /*!
+     * @details
+     * The history heuristic: history_[from][to] grows each time the move from the square from
+     * to the square to produces a cut-off, deep cut-offs counting more.
+     */
+    std::array<std::array<int, 64>, 64> history_ = {};
+
+    /*! @details Indicates if the jumps are generated by @ref availableJumpsFloodFill instead of @ref availableJumpsBFS. */
+    bool use_flood_fill_ = true;
+
+    /*! @details Indicates if the children after the first one are searched with null windows (PVS). */
+    bool use_pvs_ = false;
+    /*! @details Indicates if the root is searched with an aspiration window around the expected value. */
+    bool use_aspiration_windows_ = false;
+    /*! @details Indicates if the root is searched by @ref mtdfSearch instead of a single alpha-beta search. */
+    bool use_mtdf_ = false;
+    /*! @details The value returned by the last search of each player. It is the expected value of its next search. */
+    std::array<score_t, 2> previous_value_ = {0, 0};
+    /*! @details Indicates if @ref previous_value_ is known for each player. */
+    std::array<bool, 2> previous_value_known_ = {false, false};
+
+    /*! @details The maximum number of moves searched at each node, -1 to search them all. */
+    int tree_width_ = MAX_TREE_WIDTH;
+    /*! @details Indicates if the late moves are searched at a reduced depth first. */
+    bool use_late_move_reductions_ = true;
+    /*! @details The late move reductions used when @ref use_late_move_reductions_ is set. */
+    lmr_table_t late_move_reductions_ = computeLateMoveReductions(LMR_MIN_DEPTH, LMR_FULL_DEPTH_MOVES,
+                                                                  LMR_BASE, LMR_DIVISOR);
+    /*! @details Indicates if the leaves of the main search are extended by @ref quiescence. */
+    bool use_quiescence_ = true;
+    /*! @details The maximum number of jumps searched by @ref quiescence after a leaf. */
+    int quiescence_depth_ = QUIESCENCE_MAX_DEPTH;
+    /*! @details The minimum progress of a jump searched by @ref quiescence. */
+    score_t quiescence_margin_ = valueToScore(QUIESCENCE_MARGIN);
+    /*! @details The number of nodes visited by the quiescence search during the current search. */
+    uint64_t quiescence_nodes_ = 0;
+
+    /*! @details Indicates if the searches look for a forced win with @ref solveWin first. */
+    bool use_win_solver_ = true;
+    /*! @details The maximum length in plies of the wins looked for by @ref solveWin. */
+    int win_solver_depth_ = WIN_SOLVER_MAX_PLIES;
     /*!
      * @details
-     * Indicates if according to previous searches, a player can be sure to win.
-     * It is used to compute shortest path to win in late game. */
-    std::array<bool, 2> won_ = {false, false};
+     * The proof table of the win solver, indexed by the hash of the position and the attacker.
+     * It is kept from one move to another.
+     */
+    boost::unordered_map<uint_fast64_t, ProofEntry> proof_table_;
+    /*! @details The player looking for a win in the current run of the win solver. */
+    Player win_solver_attacker_ = 0;
+    /*! @details The number of nodes visited by the current run of the win solver. */
+    uint64_t win_solver_nodes_ = 0;
+    /*! @details The number of plies of the last win found by @ref solveWin, -1 if it found none. */
+    int distance_to_win_ = -1;
+
+    /*! @details The engine searching the position expected after the reply of the opponent (see @ref startPondering). */
+    std::unique_ptr<AlphaBeta> ponder_engine_;
+    /*! @details The thread running the search of @ref ponder_engine_. */
+    std::thread ponder_thread_;
+    /*! @details The reply of the opponent expected by the pondering, 0 if the engine is not pondering. */
+    uint_fast64_t ponder_reply_ = 0;
+    /*! @details The depth of the last iteration completed by the search of a pondering engine, 0 if none. */
+    int ponder_depth_ = 0;
+    /*! @details The best move found by the last iteration completed by the search of a pondering engine. */
+    uint_fast64_t ponder_move_ = 0;
+    /*! @details The value found by the last iteration completed by the search of a pondering engine. */
+    score_t ponder_value_ = 0;
 
     /*! @details
      * The function computes a heuristic value for the current game state
      * by evaluating the positions of the pawns on the board.
      * This value is computed using a linear function generated
-     * by genetic evolution.
-     * @sa tensorflowOrderMoves
+     * by genetic evolution. Each byte of the bit boards is a row whose weights are
+     * read at once in @ref win_rows_ and @ref lose_rows_.
+     * @sa tensorflowSortMoves
      * @return The heuristic value of the current position.
      */
-    double heuristicValue();
+    score_t heuristicValue();
+    /*!
+     * @details
+     * Computes @ref win_rows_ and @ref lose_rows_ from @ref player_to_win_score_ and @ref player_to_lose_score_.
+     * It must be called each time the weights change.
+     */
+    void computeRowWeights();
     /*!
      * @details
      * This function updates the heuristic value of the current game state
@@ -120,34 +417,280 @@ class AlphaBeta : public ChineseCheckers{
      */
     ListOfPositionType retrieveMoves(const uint_fast64_t &move);
 
- public:
-    /*! @details Function used to compare moves for sorting. */
-    std::function<bool(const uint_fast64_t&, const uint_fast64_t&)> comp_move_ =
-            [this](const uint_fast64_t &a,
-                   const uint_fast64_t &b){
-                if (who_is_to_play_) {
-                    return player_to_win_value_[__builtin_ctzll(a & ~bit_boards_.Black)]
-                           + player_to_win_value_[__builtin_ctzll(b & bit_boards_.Black)]
-                           < player_to_win_value_[__builtin_ctzll(b & ~bit_boards_.Black)]
-                             + player_to_win_value_[__builtin_ctzll(a & bit_boards_.Black)];
-                } else {
-                    return player_to_win_value_[63 - __builtin_ctzll(a & ~bit_boards_.White)]
-                           + player_to_win_value_[63 - __builtin_ctzll(b & bit_boards_.White)]
-                           < player_to_win_value_[63 - __builtin_ctzll(b & ~bit_boards_.White)]
-                             + player_to_win_value_[63 - __builtin_ctzll(a & bit_boards_.White)];
-                }
-            };
-    /*! @details Function used to compare moves for sorting. */
-    std::function<bool(const uint_fast64_t&, const uint_fast64_t&)> comp_move_black_ =
-            [&](const uint_fast64_t &a, const uint_fast64_t &b) {
-                return result_tensorFlow_[a] > result_tensorFlow_[b];
-            };
-    /*! @details Function used to compare moves for sorting. */
-    std::function<bool(const uint_fast64_t&, const uint_fast64_t&)> comp_move_white_ =
-            [&](const uint_fast64_t &a, const uint_fast64_t &b) {
-                return result_tensorFlow_[a] < result_tensorFlow_[b];
-            };
+    /*!
+     * @details
+     * Starts the helper threads of the Lazy SMP search. Each helper gets a copy of the current position
+     * and searches it with iterative deepening, starting at @ref depth or @ref depth + 1 so that the helpers do
+     * not all follow the same path. The helpers share @ref transposition_table_ with this engine, which is how
+     * their work benefits to the main search. Nothing is done if @ref number_of_threads_ is 1.
+     * With the Young Brothers Wait search, the helpers run @ref ybwcWorker instead and the main search
+     * shares its nodes with them.
+     * @param depth The depth of the main search.
+     * @param hash The hash of the current position.
+     * @sa stopHelperThreads
+     * @sa setNumberOfThreads
+     */
+    void startHelperThreads(const int &depth, const uint_fast64_t &hash);
+    /*!
+     * @details Stops the helper threads of the Lazy SMP or Young Brothers Wait search and waits for them.
+     * @sa startHelperThreads
+     */
+    void stopHelperThreads();
+    /*!
+     * @details The search run by a helper thread of the Lazy SMP search until it is asked to stop.
+     * @param depth The depth of the first iteration.
+     * @param hash The hash of the current position.
+     * @sa startHelperThreads
+     */
+    void helperSearch(const int &depth, const uint_fast64_t &hash);
+    /*!
+     * @details
+     * Indicates if the search must be stopped: the search has been stopped or a cut-off has made useless the
+     * task of the Young Brothers Wait search being searched.
+     * @return True iff the search must be stopped.
+     */
+    inline bool isSearchStopped() const {
+        return stop_search_->load(std::memory_order_relaxed)
+               || (current_split_point_ && current_split_point_->isCancelled());
+    }
+    /*!
+     * @details Searches a move of the current position and goes back to the current position.
+     * @param move The move.
+     * @param depth The depth of the current position.
+     * @param alpha The alpha value of the current position.
+     * @param beta The beta value of the current position.
+     * @param maximizingPlayer Indicates if the current position is a maximizing node.
+     * @param reduction The late move reduction of the move.
+     * @param null_window Indicates if the move is first searched with a null window by the Principal Variation Search.
+     * @param hash The hash of the current position.
+     * @param value The value of the move.
+     * @return False iff the move leads to an illegal position. Then, it is not searched.
+     */
+    bool searchMove(const uint_fast64_t &move,
+                    const int &depth,
+                    const score_t &alpha,
+                    const score_t &beta,
+                    const bool &maximizingPlayer,
+                    const int &reduction,
+                    const bool &null_window,
+                    uint_fast64_t hash,
+                    score_t &value);
+    /*!
+     * @details
+     * Young Brothers Wait: once the first move of a node has been searched, the next ones are searched in parallel.
+     * Each of them becomes a task of @ref split_tasks_. This engine searches them with the help of the idle threads
+     * and waits until they are all searched. A move causing a cut-off cancels the moves not searched yet.
+     * @param possible_moves The moves of the node.
+     * @param first_index The index of the first move to search in parallel.
+     * @param width The number of moves to search.
+     * @param depth The depth of the node.
+     * @param alpha The alpha value of the node. It is updated with the values of the moves.
+     * @param beta The beta value of the node. It is updated with the values of the moves.
+     * @param maximizingPlayer Indicates if the node is a maximizing node.
+     * @param reduce Indicates if the moves are reduced by the late move reductions.
+     * @param searched_moves The number of moves searched before the first one searched in parallel.
+     * @param hash The hash of the node.
+     * @param value The value of the node. It is updated with the values of the moves.
+     * @param best_move The best move of the node. It is updated with the values of the moves.
+     * @return True iff a move has caused a cut-off.
+     */
+    bool splitSearch(MoveList &possible_moves,
+                     const int &first_index,
+                     const int &width,
+                     const int &depth,
+                     score_t &alpha,
+                     score_t &beta,
+                     const bool &maximizingPlayer,
+                     const bool &reduce,
+                     const int &searched_moves,
+                     const uint_fast64_t &hash,
+                     score_t &value,
+                     uint_fast64_t &best_move);
+    /*!
+     * @details Searches a task of the Young Brothers Wait search and adds its value to its split point.
+     * @param task The task.
+     */
+    void searchSplitTask(const SplitTask &task);
+    /*!
+     * @details Sets the current position to the position of a split point.
+     * @param split_point The split point.
+     */
+    void loadSplitPoint(const SplitPoint &split_point);
+    /*!
+     * @details The loop of a helper thread of the Young Brothers Wait search: it steals tasks until the search is over.
+     * @sa startHelperThreads
+     */
+    void ybwcWorker();
+    /*!
+     * @details
+     * Follows the best moves stored in @ref transposition_table_ after a given move of the current position.
+     * @param move The first move.
+     * @param length The maximum number of moves of the variation.
+     * @return The variation, starting with @ref move.
+     */
+    std::vector<uint_fast64_t> principalVariation(const uint_fast64_t &move, const int &length);
+    /*!
+     * @details Copies the current position and the parameters of the search to another engine.
+     * @param engine The engine.
+     * @sa startHelperThreads
+     * @sa startPondering
+     */
+    void copySearchState(AlphaBeta &engine) const;
+    /*!
+     * @details
+     * The search run by the thread of a pondering engine until it is asked to stop.
+     * It is an iterative deepening search of the current position that records each completed iteration
+     * in @ref ponder_depth_, @ref ponder_move_ and @ref ponder_value_.
+     * @sa startPondering
+     */
+    void ponderSearch();
+    /*!
+     * @details Indicates if the position searched by @ref ponder_engine_ is the current position.
+     * @return True iff at least one iteration of the search of the current position has been completed.
+     */
+    bool isPonderHit() const;
 
+    /*!
+     * @details
+     * Adds the jumps of the current player to a list of moves.
+     * A BFS is done from each pawn, looking for the possible jumps of each square it reaches.
+     * It is the reference generator, @ref availableJumpsFloodFill generates the same moves faster.
+     * @param result The list the moves are added to.
+     * @sa availableMoves
+     */
+    void availableJumpsBFS(MoveList &result);
+    /*!
+     * @details
+     * Adds the jumps of the current player to a list of moves.
+     * The squares from which a jump is possible are computed once for each direction and distance of the pivot
+     * with whole bitboard shifts (see @ref shift_masks_). The squares reachable by a pawn are then
+     * flood filled: each step finds all the squares reachable with one more jump at once.
+     * @param result The list the moves are added to.
+     * @sa availableMoves
+     */
+    void availableJumpsFloodFill(MoveList &result);
+    /*!
+     * @details
+     * Orders the moves with the killer moves of the current ply and the history heuristic.
+     * The killer moves are searched first, then the moves are ordered by history and
+     * the static score given by @ref availableMoves breaks the ties.
+     * @param possible_moves The moves to order.
+     * @sa updateKillersAndHistory
+     */
+    void orderMovesWithKillersAndHistory(MoveList &possible_moves);
+    /*!
+     * @details Records that a move produced a cut-off.
+     * @param move The move.
+     * @param depth The remaining depth of the node where the cut-off happened.
+     * @sa orderMovesWithKillersAndHistory
+     */
+    void updateKillersAndHistory(const uint_fast64_t &move, const int &depth);
+    /*!
+     * @details
+     * Prepares the killer moves and the history heuristic for a new search.
+     * The killer moves are forgotten and the history is aged.
+     */
+    void newSearchOrdering();
+
+    /*!
+     * @details
+     * Searches the root with an aspiration window: a small window around the expected value.
+     * When the value falls outside of the window, the window is widened on this side and the root is searched again.
+     * @param depth The depth of the search.
+     * @param expected_value The value the window is centered on.
+     * @param hash The hash of the current position.
+     * @sa setAspirationWindows
+     * @return The value of the root.
+     */
+    score_t aspirationSearch(const int &depth, const score_t &expected_value, const uint_fast64_t &hash);
+    /*!
+     * @details
+     * Searches the root with MTD(f): a sequence of null window searches converging on the value of the root.
+     * Each search tells if the value is lower than the bound it is given and the next bound is the value it returns.
+     * The searches are cheap since most of the tree has already been searched by the previous ones:
+     * @ref transposition_table_ keeps the lower and upper bounds they found.
+     * @param depth The depth of the search.
+     * @param first_guess The first bound. The closer it is to the value, the fewer searches are needed.
+     * @param hash The hash of the current position.
+     * @sa setMTDF
+     * @return The value of the root.
+     */
+    score_t mtdfSearch(const int &depth, const score_t &first_guess, const uint_fast64_t &hash);
+    /*!
+     * @details Adds a completed iteration to @ref statistics_.
+     * @param depth The depth of the iteration.
+     * @param first_node The value of @ref nodes_ when the iteration started.
+     * @param start The time at which the iteration started.
+     */
+    void recordIteration(const int &depth,
+                         const uint64_t &first_node,
+                         const std::chrono::steady_clock::time_point &start);
+    /*!
+     * @details Counts a cut-off in @ref statistics_.
+     * @param searched_moves The number of moves searched by the node, including the one causing the cut-off.
+     */
+    inline void countCutoff(const int &searched_moves) {
+        ++statistics_.cutoffs;
+        statistics_.first_move_cutoffs += searched_moves == 1;
+    }
+    /*!
+     * @details
+     * Indicates if the player who has just played has won the game.
+     * @param value Set to the value of the position if the game is won.
+     * @return True iff the game is won.
+     */
+    inline bool isGameWon(score_t &value) const;
+    /*!
+     * @details Indicates if a player has won the game by occupying all the winning positions for their color.
+     * @param player The player.
+     * @return True iff the player has won.
+     */
+    inline bool hasWon(const Player &player) const;
+    /*!
+     * @details
+     * Proves that @ref win_solver_attacker_ wins within a number of plies. Each node of the search is either
+     * an attacker node, where one winning move is enough, or a defender node, where all the moves must lose.
+     * The results are stored in @ref proof_table_.
+     * A position is disproved at once when the attacker has fewer moves left than empty winning positions to fill.
+     * @param plies The maximum number of plies, including the move of the player to play.
+     * @sa solveWin
+     * @return True iff the win is proven. False if it is disproven or if the nodes budget is exhausted.
+     */
+    bool proveWin(const int &plies);
+    /*!
+     * @details
+     * Extends a leaf of the main search with the jumps that make a lot of progress.
+     * A long jump changes the heuristic value a lot, hence the value of a leaf where one is available is not reliable.
+     * Only the jumps whose progress exceeds @ref quiescence_margin_ are searched. The player to play can also stand pat:
+     * they are assumed to be able to keep the heuristic value of the position with another move.
+     * The nodes are counted in @ref quiescence_nodes_ instead of @ref nodes_.
+     * @param depth The maximum number of jumps still allowed.
+     * @param alpha Check the Alpha-Beta algorithm to know what this is.
+     * @param beta Check the Alpha-Beta algorithm to know what this is.
+     * @param maximizingPlayer Indicates if the current player if the maximizing player.
+     * @sa setQuiescence
+     * @return The value of the leaf.
+     */
+    score_t quiescence(const int &depth, score_t alpha, score_t beta, const bool &maximizingPlayer);
+    /*!
+     * @details
+     * Searches the current position with iterative deepening until the time budget is exhausted
+     * or the maximum depth is reached (see @ref getMove64Within).
+     * @param max_depth The depth of the last iteration.
+     * @param time_ms The time budget in milliseconds.
+     * @return The best move found by the last completed iteration of the search.
+     */
+    uint_fast64_t iterativeDeepening(const int &max_depth, const int &time_ms);
+    /*! @details
+     * Copy the object but share a transposition table. Like the copy constructor, the helpers of @ref other
+     * are not shared.
+     * @param other The object to copy.
+     * @param transposition_table The transposition table used by the copy.
+     * @sa search
+     */
+    AlphaBeta(const AlphaBeta &other, const std::shared_ptr<TranspositionTable> &transposition_table);
+
+ public:
     /* Constructors */
     /*! @details
      * Construct the object.
@@ -163,6 +706,14 @@ class AlphaBeta : public ChineseCheckers{
      */
     AlphaBeta(const std::vector<double> &player_to_win_value_,
               const std::vector<double> &player_to_lose_value_);
+    /*! @details
+     * Copy the object. The copy gets its own transposition table and does not share
+     * the helpers of the Lazy SMP search of @ref other.
+     * @param other The object to copy.
+     */
+    AlphaBeta(const AlphaBeta &other);
+    /*! @details Destroy the object. The helper threads are stopped first. */
+    ~AlphaBeta();
 
     /*!
      * @details
@@ -192,6 +743,8 @@ class AlphaBeta : public ChineseCheckers{
      * This function implements the Alpha-Beta search algorithm to find the best move in a game state.
      * It uses of zero width windows heuristic when a sure win has been detected which makes the end-game
      * faster and improves a lot the quality of the player.
+     * On a ponder hit, the move found by the pondering is returned at once if the pondering went as deep as asked.
+     * Otherwise, its value is the first guess of the search (see @ref startPondering).
      * @param depth Indicates how deep we should explore the tree.
      * @sa getMove
      * @sa AlphaBetaEval
@@ -202,23 +755,139 @@ class AlphaBeta : public ChineseCheckers{
      * @return The best move according to the alpha beta algorithm.
      */
     uint_fast64_t getMove64(const int &depth);
+    /*!
+     * @details
+     * Returns the best move the AI agent can find within a given amount of time.
+     * The opening book is checked first like in @ref getMove. Otherwise, @ref getMove64Within is called.
+     * @param time_ms The time budget in milliseconds.
+     * @sa getMove64Within
+     * @return The best move found by the last completed iteration of the search.
+     */
+    ListOfPositionType getMoveWithin(const int &time_ms);
+    /*!
+     * @details
+     * Searches the current position with iterative deepening until the time budget is exhausted.
+     * Each iteration stores its best moves in @ref transposition_table_ and they are searched first
+     * by the next iteration. The search is checked against @ref deadline_ regularly and aborted when it is reached:
+     * the move returned is the one found by the last completed iteration.
+     * The first iteration is always completed so that a move is returned even with a tiny budget.
+     * @param time_ms The time budget in milliseconds.
+     * @sa getMove64
+     * @return The best move found by the last completed iteration of the search.
+     */
+    uint_fast64_t getMove64Within(const int &time_ms);
+    /*!
+     * @details
+     * Searches a position without changing this engine. The search runs in its own context: a copy of this engine
+     * which shares @ref transposition_table_ and the opening book. Hence several searches can run at the same time,
+     * from different threads, and benefit from each other through the transposition table.
+     * The search is a @ref getMove64 search if there is no time limit and a @ref getMove64Within search otherwise,
+     * whose iterations stop at the depth limit. The opening book is not used.
+     * The search deliberately starts cold: only the transposition table is shared. The first guess of
+     * MTD(f) and of the aspiration windows is not taken from the previous searches and the proofs of the
+     * win solver are not kept, since nothing tells that the searches are about the same game.
+     * @param position The position.
+     * @param limits The limits of the search.
+     * @return The best move, the value of the position and the statistics of the search.
+     */
+    SearchResult search(const Position &position, const Limits &limits) const;
+    /*!
+     * @details
+     * Scores the moves of the root in a single search. The search deepens iteratively up to the given depth
+     * and all the moves of the root share @ref transposition_table_, the killer moves and the history.
+     * The number_of_pvs best moves get their exact value and their principal variation. The other ones are only
+     * searched with a null window showing that they are not better than the worst of the best moves.
+     * The illegal moves are skipped and the opening book is not used. @ref best_move_ is set to the best move.
+     * @param depth Indicates how deep we should explore the tree.
+     * @param number_of_pvs The number of moves whose exact value is needed, -1 for all of them.
+     * @sa analyse
+     * @return The moves, from the best to the worst one for the player to play.
+     */
+    std::vector<RootMove> multiPVSearch(const int &depth, const int &number_of_pvs);
+    /*!
+     * @details
+     * Looks for the shortest forced win of the player to play, up to a given number of plies.
+     * The number of plies is increased by two until a win is found, hence the first win found is the shortest one.
+     * The proof table is kept, so the next moves of the same win are found almost at once.
+     * The repetitions are ignored. Only the moves filling an empty winning position are tried when the attacker
+     * has no move to spare: a win can be missed but a win found is always a forced one.
+     * @param max_plies The maximum number of plies of the win.
+     * @sa getDistanceToWin
+     * @return The number of plies of the win, -1 if no win has been found. @ref best_move_ is set to the
+     * first move of the win.
+     */
+    int solveWin(const int &max_plies);
+    /*!
+     * @details Returns the best moves of the current position with their values (see @ref multiPVSearch).
+     * @param depth Indicates how deep we should explore the tree.
+     * @param number_of_pvs The number of moves returned, -1 for all of them.
+     * @return The moves, from the best to the worst one, and their exact values.
+     */
+    std::vector<std::pair<ListOfPositionType, double>> analyse(const int &depth, const int &number_of_pvs);
+    /*!
+     * @details
+     * Starts pondering: the position expected after the reply of the opponent is searched in a background thread
+     * while the opponent is thinking. It must be called once the move returned by the last search has been played.
+     * The expected reply is the best move stored in @ref transposition_table_ for the current position.
+     * The next search stops the pondering. If the opponent has played the expected reply (a ponder hit),
+     * @ref getMove64 and @ref getMove64Within continue from the iterations completed by the pondering.
+     * Otherwise, only the content of the transposition table is kept.
+     * @sa stopPondering
+     * @return True iff the pondering has been started.
+     */
+    bool startPondering();
+    /*!
+     * @details Stops the pondering and waits for its thread. Nothing is done if the engine is not pondering.
+     * @sa startPondering
+     * @return True iff the position searched by the pondering is the current position (a ponder hit).
+     */
+    bool stopPondering();
+    /*!
+     * @details Indicates if the engine is pondering.
+     * @return True iff the pondering has been started and not stopped yet.
+     */
+    bool isPondering() const;
+    /*!
+     * @details Returns \ref ponder_reply_.
+     * @return The reply of the opponent expected by the pondering, 0 if the engine is not pondering.
+     */
+    uint_fast64_t getPonderReply() const;
     /*! @details
      * This function calculates all available moves for the current player
-     * and stores them in the result vector.
-     * The result vector is passed as a reference so that it can be modified
-     * inside the function.
+     * and adds them to the result list.
+     * Each move is scored with @ref player_to_win_value_ according to the progress
+     * it makes towards the winning positions so that the best moves can be picked first.
+     * @param result The list the moves are added to.
      * @sa getMove
-     * @sa tensorflowOrderMoves
+     * @sa tensorflowSortMoves
      */
-    void availableMoves(std::set<uint_fast64_t, decltype(comp_move_)> &result);
+    void availableMoves(MoveList &result);
     /*! @details
-     * The moves are ordered using a tensorflow model that estimates
+     * The moves are scored using a tensorflow model that estimates
      * the value that the alpha-beta algorithm would assign to each move.
-     * @param possible_moves The list of moves we could play.
+     * @param possible_moves The list of moves we could play. Their scores are replaced.
      * @sa heuristicValue
      * @sa availableMoves
      */
-    void tensorflowSortMoves(std::set<uint_fast64_t, decltype(comp_move_)> &possible_moves);
+    void tensorflowSortMoves(MoveList &possible_moves);
+
+    /*! @details
+     * Counts the positions reached after a given number of moves from the current position.
+     * The moves are generated by @ref availableMoves and the illegal positions are skipped,
+     * exactly like in the search. The end of the game is not detected.
+     * It is used to check and to time the move generation.
+     * @param depth The number of moves.
+     * @sa perftDivide
+     * @return The number of positions reached.
+     */
+    uint64_t perft(const int &depth);
+    /*! @details
+     * Same as @ref perft but the count is given for each move of the current position.
+     * @param depth The number of moves, including the first one.
+     * @sa perft
+     * @return The number of positions reached for each legal move of the current position.
+     */
+    std::vector<std::pair<uint_fast64_t, uint64_t>> perftDivide(const int &depth);
 
     /*! @details
      * This methode performs an Alpha-Beta search in the game tree to find the best move
@@ -231,27 +900,42 @@ class AlphaBeta : public ChineseCheckers{
      * @param beta Check the Alpha-Beta algorithm to know what this is.
      * @param maximizingPlayer Indicates if the current player if the maximizing player.
      * @param keepMove indicates if the best move from the current depth should be kept.
+     * The root, i.e., the node at @ref ply_ 0, is searched even if it is a repetition or if its value is in
+     * @ref transposition_table_, and its moves are not reduced, whether its best move is kept or not.
      * @sa getMove
      * @sa getMove64
      * @sa availableMoves
      * @sa heuristicValue
      * @return The value computed by the alpha beta algorithm. Sets \ref best_move_ if asked to.
      */
-    const double AlphaBetaEval(const int &depth,
-                               double alpha,
-                               double beta,
-                               const bool &maximizingPlayer,
-                               const bool &keepMove,
-                               uint_fast64_t hash);
+    const score_t AlphaBetaEval(const int &depth,
+                                score_t alpha,
+                                score_t beta,
+                                const bool &maximizingPlayer,
+                                const bool &keepMove,
+                                uint_fast64_t hash);
 
     /*! @details A helper function for the python connexion */
     bool isHuman() { return false; }
 
     /*! @details
-     * This function loads the pre-calculated opening moves from a file and
-     * stores them in the @ref opening_ map for later use in the alpha-beta algorithm.
+     * This function loads the pre-calculated opening moves from the files.
+     * @return The openings, indexed by player and by position.
+     * @sa sharedOpenings
+     */
+    static std::shared_ptr<openings_t> loadOpenings();
+    /*! @details
+     * Returns the openings of the files. They are loaded by the first call, which is thread-safe,
+     * and shared by all the engines of the process.
+     * @return The openings used by @ref getMove.
+     */
+    static std::shared_ptr<const openings_t> sharedOpenings();
+    /*! @details
+     * Returns the tensorflow model. It is loaded by the first call, which is thread-safe,
+     * and shared by all the engines of the process. Nothing is loaded if no engine uses it.
+     * @return The model used by @ref tensorflowSortMoves.
      */
-    void loadOpenings();
+    static std::shared_ptr<cppflow::model> sharedModel();
 
     /*!
      * @details Returns \ref maximizing_player_.
@@ -269,15 +953,278 @@ class AlphaBeta : public ChineseCheckers{
      */
     std::vector<double> getPlayerToWinValue();
     /*!
-     * @details Sets \ref player_to_lose_value_.
+     * @details Sets \ref player_to_lose_value_ and quantizes it in \ref player_to_lose_score_.
      * @param player_to_lose_value_ The value to set.
      */
     void setPlayerToLoseValue(const std::vector<double> &player_to_lose_value_);
     /*!
-     * @details Sets \ref player_to_win_value_.
+     * @details Sets \ref player_to_win_value_ and quantizes it in \ref player_to_win_score_.
      * @param player_to_win_value_ The value to set.
      */
     void setPlayerToWinValue(const std::vector<double> &player_to_win_value_);
+    /*!
+     * @details
+     * Converts the weights of the squares to scores. Each weight is clamped to [-1, 1] first so that
+     * the heuristic values never reach the scores of the draws and of the wins.
+     * @param weights The weight of each square. The missing ones are 0.
+     * @return The scores of the squares.
+     */
+    static weights_t quantizeWeights(const std::vector<double> &weights);
+    /*!
+     * @details
+     * Sets the number of threads used by a search. When more than one thread is used,
+     * the search is a Lazy SMP search: the helper threads search the same position
+     * and share the transposition table with the main thread which returns @ref best_move_.
+     * The threads can also share the nodes of the search (see @ref setYoungBrothersWait).
+     * @param number_of_threads The number of threads. Values lower than 1 are treated as 1.
+     * @sa getNumberOfThreads
+     */
+    void setNumberOfThreads(const int &number_of_threads);
+    /*!
+     * @details
+     * Chooses how the threads share a search. By default, they search the whole tree with the Lazy SMP search
+     * and only share the transposition table. With the Young Brothers Wait search, they search the moves of the same
+     * nodes in parallel once the first move of the node has been searched (see @ref splitSearch).
+     * @param use_ybwc True to use the Young Brothers Wait search.
+     * @sa setNumberOfThreads
+     */
+    void setYoungBrothersWait(const bool &use_ybwc);
+    /*!
+     * @details Returns \ref use_ybwc_.
+     * @return @ref use_ybwc_.
+     */
+    bool getYoungBrothersWait() const;
+    /*!
+     * @details Returns \ref number_of_threads_.
+     * @return @ref number_of_threads_.
+     */
+    int getNumberOfThreads() const;
+    /*!
+     * @details Sets the size of \ref transposition_table_. Its content is lost.
+     * @param size_mb The size in MB.
+     * @sa getTranspositionTableSize
+     */
+    void setTranspositionTableSize(const int &size_mb);
+    /*!
+     * @details Returns the size of \ref transposition_table_.
+     * @return The size of @ref transposition_table_ in MB.
+     */
+    int getTranspositionTableSize() const;
+    /*!
+     * @details Enables or disables the killer moves and the history heuristic.
+     * @param use_killers_and_history True to use them.
+     * @sa orderMovesWithKillersAndHistory
+     */
+    void setKillersAndHistory(const bool &use_killers_and_history);
+    /*!
+     * @details Returns \ref use_killers_and_history_.
+     * @return @ref use_killers_and_history_.
+     */
+    bool getKillersAndHistory() const;
+    /*!
+     * @details Returns the number of nodes visited by the last search of this thread.
+     * @return @ref nodes_.
+     */
+    uint64_t getNodeCount() const;
+    /*!
+     * @details Returns the number of nodes visited by the quiescence search during the last search of this thread.
+     * They are not counted by @ref getNodeCount.
+     * @return @ref quiescence_nodes_.
+     */
+    uint64_t getQuiescenceNodeCount() const;
+    /*!
+     * @details
+     * Returns the statistics of the last search of this thread (@ref getMove64, @ref getMove64Within
+     * or @ref multiPVSearch). Only the nodes are counted when the build defines SEARCH_STATISTICS_DISABLED.
+     * @return The statistics.
+     */
+    SearchStatistics getSearchStatistics() const;
+    /*!
+     * @details
+     * Enables or disables the Principal Variation Search. When it is enabled, the first child of a node
+     * is searched with the full window and the other ones with a null window that only tells if they are better.
+     * A child that is better is searched again with the full window.
+     * @param use_pvs True to use the Principal Variation Search.
+     * @sa getPrincipalVariationSearch
+     */
+    void setPrincipalVariationSearch(const bool &use_pvs);
+    /*!
+     * @details Returns \ref use_pvs_.
+     * @return @ref use_pvs_.
+     */
+    bool getPrincipalVariationSearch() const;
+    /*!
+     * @details Enables or disables the aspiration windows at the root (see @ref aspirationSearch).
+     * @param use_aspiration_windows True to use aspiration windows.
+     * @sa getAspirationWindows
+     */
+    void setAspirationWindows(const bool &use_aspiration_windows);
+    /*!
+     * @details Returns \ref use_aspiration_windows_.
+     * @return @ref use_aspiration_windows_.
+     */
+    bool getAspirationWindows() const;
+    /*!
+     * @details
+     * Chooses the driver of the search of the root: @ref mtdfSearch or a single alpha-beta search
+     * (with an aspiration window if @ref use_aspiration_windows_ is set).
+     * The first guess of MTD(f) is the value of the previous search of the player.
+     * @param use_mtdf True to use MTD(f).
+     * @sa getMTDF
+     */
+    void setMTDF(const bool &use_mtdf);
+    /*!
+     * @details Returns \ref use_mtdf_.
+     * @return @ref use_mtdf_.
+     */
+    bool getMTDF() const;
+    /*!
+     * @details Sets the maximum number of moves searched at each node. The best moves according to the ordering are kept.
+     * @param tree_width The number of moves, -1 to search all of them.
+     * @sa getTreeWidth
+     */
+    void setTreeWidth(const int &tree_width);
+    /*!
+     * @details Returns \ref tree_width_.
+     * @return @ref tree_width_.
+     */
+    int getTreeWidth() const;
+    /*!
+     * @details
+     * Enables or disables the late move reductions. When they are enabled, the moves ordered after the first ones
+     * are searched at a reduced depth (see @ref setLateMoveReductionTable) with a null window. A move that
+     * turns out to be better than the current best one is searched again at full depth.
+     * Combined with an unlimited tree width, the late moves are still searched, but cheaply.
+     * @param use_late_move_reductions True to use the late move reductions.
+     * @sa getLateMoveReductions
+     */
+    void setLateMoveReductions(const bool &use_late_move_reductions);
+    /*!
+     * @details Returns \ref use_late_move_reductions_.
+     * @return @ref use_late_move_reductions_.
+     */
+    bool getLateMoveReductions() const;
+    /*!
+     * @details
+     * Sets the late move reductions. A move is not reduced if the depth of the node is lower than min_depth
+     * or if it is one of the full_depth_moves first moves. Otherwise, the i-th move of a node of depth d
+     * is reduced by base + ln(d) * ln(i) / divisor plies, the search of the move keeping at least one ply.
+     * @param min_depth The minimum depth of a node to reduce its moves.
+     * @param full_depth_moves The number of moves searched at full depth.
+     * @param base The minimum reduction.
+     * @param divisor The greater it is, the smaller the reductions.
+     * @sa getLateMoveReduction
+     */
+    void setLateMoveReductionTable(const int &min_depth,
+                                   const int &full_depth_moves,
+                                   const double &base,
+                                   const double &divisor);
+    /*!
+     * @details Returns the reduction of a move.
+     * @param depth The depth of the node.
+     * @param index The index of the move in the node, 0 for the first move searched.
+     * @return The number of plies the move is reduced by.
+     */
+    int getLateMoveReduction(const int &depth, const int &index) const;
+    /*!
+     * @details Computes a table of late move reductions (see @ref setLateMoveReductionTable).
+     * @param min_depth The minimum depth of a node to reduce its moves.
+     * @param full_depth_moves The number of moves searched at full depth.
+     * @param base The minimum reduction.
+     * @param divisor The greater it is, the smaller the reductions.
+     * @return The table.
+     */
+    static lmr_table_t computeLateMoveReductions(const int &min_depth,
+                                                 const int &full_depth_moves,
+                                                 const double &base,
+                                                 const double &divisor);
+    /*!
+     * @details Returns \ref distance_to_win_.
+     * @return The number of plies of the win found by the last search, -1 if it found none.
+     */
+    int getDistanceToWin() const;
+    /*!
+     * @details
+     * Enables or disables the win solver. When it is enabled, @ref getMove64 and @ref getMove64Within look for a
+     * forced win with @ref solveWin before searching with the alpha-beta algorithm.
+     * @param use_win_solver True to use the win solver.
+     * @sa getWinSolver
+     */
+    void setWinSolver(const bool &use_win_solver);
+    /*!
+     * @details Returns \ref use_win_solver_.
+     * @return @ref use_win_solver_.
+     */
+    bool getWinSolver() const;
+    /*!
+     * @details Sets the maximum length of the wins looked for by the win solver.
+     * @param win_solver_depth The number of plies.
+     * @sa getWinSolverDepth
+     */
+    void setWinSolverDepth(const int &win_solver_depth);
+    /*!
+     * @details Returns \ref win_solver_depth_.
+     * @return @ref win_solver_depth_.
+     */
+    int getWinSolverDepth() const;
+    /*!
+     * @details
+     * Enables or disables the quiescence search at the leaves of the main search (see @ref quiescence).
+     * @param use_quiescence True to use the quiescence search.
+     * @sa getQuiescence
+     */
+    void setQuiescence(const bool &use_quiescence);
+    /*!
+     * @details Returns \ref use_quiescence_.
+     * @return @ref use_quiescence_.
+     */
+    bool getQuiescence() const;
+    /*!
+     * @details Sets the maximum number of jumps searched by the quiescence search after a leaf.
+     * @param quiescence_depth The number of jumps. Negative values are treated as 0.
+     * @sa getQuiescenceDepth
+     */
+    void setQuiescenceDepth(const int &quiescence_depth);
+    /*!
+     * @details Returns \ref quiescence_depth_.
+     * @return @ref quiescence_depth_.
+     */
+    int getQuiescenceDepth() const;
+    /*!
+     * @details Sets the minimum progress of a jump searched by the quiescence search.
+     * @param quiescence_margin The progress, in units of @ref player_to_win_value_. It is quantized like the weights.
+     * @sa getQuiescenceMargin
+     */
+    void setQuiescenceMargin(const double &quiescence_margin);
+    /*!
+     * @details Returns \ref quiescence_margin_.
+     * @return @ref quiescence_margin_.
+     */
+    double getQuiescenceMargin() const;
+    /*!
+     * @details Chooses the generator of the jumps used by @ref availableMoves. Both generate the same moves.
+     * @param use_flood_fill True to use @ref availableJumpsFloodFill, false to use @ref availableJumpsBFS.
+     * @sa getFloodFillMoveGeneration
+     */
+    void setFloodFillMoveGeneration(const bool &use_flood_fill);
+    /*!
+     * @details Returns \ref use_flood_fill_.
+     * @return @ref use_flood_fill_.
+     */
+    bool getFloodFillMoveGeneration() const;
+    /*!
+     * @details
+     * Enables or disables the ordering of the moves of the root by the tensorflow model (see @ref tensorflowSortMoves).
+     * The model is loaded when the ordering is enabled for the first time in the process.
+     * @param use_neural_network_ordering True to order the moves with the model.
+     * @sa getNeuralNetworkOrdering
+     */
+    void setNeuralNetworkOrdering(const bool &use_neural_network_ordering);
+    /*!
+     * @details Returns \ref use_neural_network_ordering_.
+     * @return @ref use_neural_network_ordering_.
+     */
+    bool getNeuralNetworkOrdering() const;
 };
 
 #endif  // SOLVERS_ALPHABETA_INCLUDE_ALPHABETA_HPP_
@@ -0,0 +1,117 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * @file MoveList.hpp
+ * @brief Move list declaration.
+ *
+ * Declaration of the MoveList Class which stores the moves available in a position.
+ *
+ */
+
+#ifndef SOLVERS_ALPHABETA_INCLUDE_MOVELIST_HPP_
+#define SOLVERS_ALPHABETA_INCLUDE_MOVELIST_HPP_
+
+/* C Libraries */
+#include <stdint.h>
+
+/* C++ libraries */
+#include <array>
+#include <utility>
+#include <algorithm>
+
+/* The maximum number of moves in a position: each of the 10 pawns can at most reach the 54 free squares. */
+#define MAX_NUMBER_OF_MOVES (540)
+
+/*!
+ * @brief
+ * The MoveList class is a fixed capacity list of moves living on the stack.
+ * Each move comes with a score used to order the moves: the higher the score, the sooner the move is searched.
+ * The moves are not sorted when they are added. @ref pickBest selects them lazily, which is cheaper
+ * than sorting the whole list when a cut-off happens after a few moves.
+ */
+class MoveList {
+ private:
+    /*! @details The moves. Only the @ref size_ first ones are meaningful. */
+    std::array<uint_fast64_t, MAX_NUMBER_OF_MOVES> moves_;
+    /*! @details The score of each move. */
+    std::array<double, MAX_NUMBER_OF_MOVES> scores_;
+    /*! @details The number of moves in the list. */
+    int size_ = 0;
+
+ public:
+    /*! @details Adds a move to the list.
+     * @param move The move. Only two bits must be set : the original position and the arrival position.
+     * @param score The score of the move.
+     */
+    inline void add(const uint_fast64_t &move, const double &score) {
+        moves_[size_]  = move;
+        scores_[size_] = score;
+        ++size_;
+    }
+
+    /*! @details Removes all the moves. */
+    inline void clear() { size_ = 0; }
+    /*! @details Returns the number of moves.
+     * @return @ref size_.
+     */
+    inline int size() const { return size_; }
+    /*! @details Indicates if the list is empty.
+     * @return True iff there is no move in the list.
+     */
+    inline bool empty() const { return !size_; }
+
+    /*! @details Returns the i-th move of the list.
+     * @param i The index of the move.
+     * @return The i-th move.
+     */
+    inline const uint_fast64_t &operator[](const int &i) const { return moves_[i]; }
+    /*! @details Returns the score of the i-th move of the list.
+     * @param i The index of the move.
+     * @return The score of the i-th move.
+     */
+    inline double &score(const int &i) { return scores_[i]; }
+
+    /*! @details Iterator on the first move. */
+    inline const uint_fast64_t *begin() const { return moves_.data(); }
+    /*! @details Iterator after the last move. */
+    inline const uint_fast64_t *end() const { return moves_.data() + size_; }
+
+    /*!
+     * @details
+     * Moves the best move among the moves i, i + 1, ... to the index i and returns it.
+     * Calling it with i = 0, 1, 2, ... gives the moves from the best to the worst.
+     * @param i The index of the move to select.
+     * @return The selected move.
+     */
+    inline uint_fast64_t pickBest(const int &i) {
+        int best = i;
+        for (int j = i + 1; j < size_; ++j) {
+            if (scores_[j] > scores_[best])
+                best = j;
+        }
+        std::swap(moves_[i], moves_[best]);
+        std::swap(scores_[i], scores_[best]);
+        return moves_[i];
+    }
+
+    /*!
+     * @details Gives a move a score higher than any other one so that it is picked first.
+     * @param move The move. Nothing is done if it is not in the list.
+     * @return True iff the move is in the list.
+     */
+    inline bool prioritize(const uint_fast64_t &move) {
+        for (int i = 0; i < size_; ++i) {
+            if (moves_[i] == move) {
+                scores_[i] = *std::max_element(scores_.begin(), scores_.begin() + size_) + 1;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+#endif  // SOLVERS_ALPHABETA_INCLUDE_MOVELIST_HPP_
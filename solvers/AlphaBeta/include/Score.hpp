@@ -0,0 +1,61 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * @file Score.hpp
+ * @brief Score declaration.
+ *
+ * Declaration of the integer scores used by the search of AlphaBeta instead of floating point values.
+ *
+ */
+
+#ifndef SOLVERS_ALPHABETA_INCLUDE_SCORE_HPP_
+#define SOLVERS_ALPHABETA_INCLUDE_SCORE_HPP_
+
+/* C Libraries */
+#include <stdint.h>
+
+/* C++ libraries */
+#include <cmath>
+
+/* The number of score units in a unit of value. The default weights of AlphaBeta are multiples of 1/588,
+ * hence they are exact scores. */
+#define SCORE_SCALE (588)
+/* The weights are clamped to [-1, 1] when they are quantized. A heuristic value adds up to 10 weights
+ * for each player, hence it stays within [-MAX_HEURISTIC_SCORE, MAX_HEURISTIC_SCORE]. */
+#define MAX_HEURISTIC_SCORE (10 * SCORE_SCALE)
+/* The score of a draw. It is as bad as the worst heuristic value for the player we are playing for. */
+#define DRAW_SCORE (MAX_HEURISTIC_SCORE)
+/* The score of a win of the player we are not playing for. The wins are out of reach of the heuristic values
+ * and the draws. The win of the player we are playing for is -WIN_SCORE. */
+#define WIN_SCORE (20 * SCORE_SCALE)
+
+/*!
+ * @details
+ * A score, i.e., a value of the search in units of 1/@ref SCORE_SCALE.
+ * The scores lie within [-WIN_SCORE - 1, WIN_SCORE + 1], hence they fit in 16 bits once stored.
+ */
+typedef int32_t score_t;
+
+/*!
+ * @details Converts a value to the nearest score.
+ * @param value The value.
+ * @return The score.
+ */
+inline score_t valueToScore(const double &value) {
+    return static_cast<score_t>(std::lround(value * SCORE_SCALE));
+}
+
+/*!
+ * @details Converts a score to a value.
+ * @param score The score.
+ * @return The value.
+ */
+inline double scoreToValue(const score_t &score) {
+    return static_cast<double>(score) / SCORE_SCALE;
+}
+
+#endif  // SOLVERS_ALPHABETA_INCLUDE_SCORE_HPP_
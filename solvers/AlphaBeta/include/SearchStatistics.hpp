@@ -0,0 +1,98 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * @file SearchStatistics.hpp
+ * @brief Search statistics declaration.
+ *
+ * Declaration of the SearchStatistics structure which counts what happens inside a search.
+ *
+ */
+
+#ifndef SOLVERS_ALPHABETA_INCLUDE_SEARCHSTATISTICS_HPP_
+#define SOLVERS_ALPHABETA_INCLUDE_SEARCHSTATISTICS_HPP_
+
+/* C Libraries */
+#include <stdint.h>
+
+/* C++ libraries */
+#include <cmath>
+#include <vector>
+
+/* The statistics are counted unless the build defines SEARCH_STATISTICS_DISABLED.
+ * SEARCH_STATISTIC(statement) runs the statement only when they are counted. */
+#ifdef SEARCH_STATISTICS_DISABLED
+#define SEARCH_STATISTIC(...)
+#else
+#define SEARCH_STATISTIC(...) __VA_ARGS__
+#endif
+
+/*! @details An iteration of a search: the search of the root at a given depth. */
+struct IterationStatistics {
+    /*! @details The depth of the iteration. */
+    int depth = 0;
+    /*! @details The number of nodes visited by the iteration. */
+    uint64_t nodes = 0;
+    /*! @details The duration of the iteration in milliseconds. */
+    double time_ms = 0;
+
+    bool operator==(const IterationStatistics &other) const = default;
+};
+
+/*!
+ * @brief
+ * The SearchStatistics structure counts what happens inside a search of AlphaBeta.
+ * Only the nodes are counted when the build defines SEARCH_STATISTICS_DISABLED: the other counters stay at 0
+ * and cost nothing to the search.
+ */
+struct SearchStatistics {
+    /*! @details The number of nodes visited by the alpha-beta search. */
+    uint64_t nodes = 0;
+    /*! @details The number of nodes visited by the quiescence search. */
+    uint64_t quiescence_nodes = 0;
+    /*! @details The number of nodes visited by the helper threads. They are not counted in @ref nodes. */
+    uint64_t helper_nodes = 0;
+    /*! @details The number of leaves of the alpha-beta search, i.e., the nodes searched at depth 0. */
+    uint64_t leaf_nodes = 0;
+    /*! @details The number of moves leading to an illegal position. */
+    uint64_t illegal_positions = 0;
+    /*! @details The number of lookups in the transposition table. */
+    uint64_t tt_probes = 0;
+    /*! @details The number of lookups finding the position. */
+    uint64_t tt_hits = 0;
+    /*! @details The number of nodes whose value is given by the transposition table. */
+    uint64_t tt_cutoffs = 0;
+    /*! @details The number of nodes where a move has caused a cut-off. */
+    uint64_t cutoffs = 0;
+    /*! @details The number of nodes where the first move searched has caused a cut-off. */
+    uint64_t first_move_cutoffs = 0;
+    /*! @details The completed iterations, from the shallowest to the deepest one. */
+    std::vector<IterationStatistics> iterations;
+
+    /*!
+     * @details Measures the move ordering: the best move should be searched first.
+     * @return The ratio of the cut-offs caused by the first move searched.
+     */
+    double firstMoveCutoffRate() const {
+        return cutoffs ? static_cast<double>(first_move_cutoffs) / cutoffs : 0;
+    }
+    /*!
+     * @details
+     * Measures how much the tree grows with the depth: the ratio of the nodes of the last two iterations.
+     * With a single iteration, it is the branching factor of a uniform tree of the same size.
+     * @return The effective branching factor (0 if no iteration is known).
+     */
+    double effectiveBranchingFactor() const {
+        if (iterations.empty())
+            return 0;
+        const IterationStatistics &last = iterations.back();
+        if (iterations.size() > 1 && iterations[iterations.size() - 2].nodes)
+            return static_cast<double>(last.nodes) / iterations[iterations.size() - 2].nodes;
+        return last.depth > 0 ? std::pow(static_cast<double>(last.nodes), 1.0 / last.depth) : 0;
+    }
+};
+
+#endif  // SOLVERS_ALPHABETA_INCLUDE_SEARCHSTATISTICS_HPP_
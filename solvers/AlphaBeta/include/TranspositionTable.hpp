@@ -0,0 +1,162 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * @file TranspositionTable.hpp
+ * @brief Transposition table declaration.
+ *
+ * Declaration of the TranspositionTable Class which stores the results of previous searches.
+ * The table can be shared between several threads without any lock.
+ *
+ */
+
+#ifndef SOLVERS_ALPHABETA_INCLUDE_TRANSPOSITIONTABLE_HPP_
+#define SOLVERS_ALPHABETA_INCLUDE_TRANSPOSITIONTABLE_HPP_
+
+/* C Libraries */
+#include <stdint.h>
+
+/* C++ libraries */
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+
+/* Other */
+#include "Score.hpp"
+
+/* The default size of the table in MB. */
+#define DEFAULT_TRANSPOSITION_TABLE_SIZE_MB (16)
+/* The number of entries in a bucket. A bucket fills a cache line. */
+#define TRANSPOSITION_TABLE_BUCKET_SIZE (8)
+
+/*! \enum Bound
+    \brief Used to denote the kind of value stored in the transposition table.
+*/
+enum Bound { NoBound = 0, UpperBound = 1, LowerBound = 2, ExactBound = 3 };
+
+/*!
+ * @brief
+ * The TranspositionTable class is a fixed size hash table used to store the results of previous searches.
+ * The table is made of buckets of @ref TRANSPOSITION_TABLE_BUCKET_SIZE entries aligned on cache lines.
+ * It is lock-free: each entry is a single 64 bits word holding the data and the highest bits of the hash,
+ * which is written and read at once. This allows several threads to share a single table
+ * (see Lazy SMP in @ref AlphaBeta).
+ *
+ * The table is not cleared between two searches. Each entry records the generation of the search that wrote it
+ * and, when a bucket is full, the entry with the lowest depth and the oldest generation is replaced.
+ */
+class TranspositionTable {
+ public:
+    /*! @details The content of an entry. */
+    struct Data {
+        /*! @details The value computed for the position. */
+        score_t value;
+        /*! @details The depth used to compute @ref value. */
+        int depth;
+        /*! @details Indicates if @ref value is exact, a lower bound or an upper bound. */
+        Bound bound;
+        /*! @details The best move found for the position (0 if none). */
+        uint_fast64_t move;
+    };
+
+ private:
+    /*!
+     * @details
+     * An entry of the table. It packs the value (16 bits), the depth (8 bits), the bound (2 bits),
+     * the generation (6 bits), the two squares of the best move (6 bits each) and the 20 highest bits
+     * of the hash, which verify the entry. The lowest bits of the hash give the bucket.
+     * An empty entry is 0.
+     */
+    typedef std::atomic<uint64_t> Entry;
+
+    /*! @details A bucket of entries. It fills exactly one cache line. */
+    struct alignas(64) Bucket {
+        /*! @details The entries of the bucket. */
+        Entry entries[TRANSPOSITION_TABLE_BUCKET_SIZE];
+    };
+
+    /*! @details The buckets of the table. They are allocated on first use. */
+    std::unique_ptr<Bucket[]> buckets_;
+    /*! @details Mask used to compute the index of a bucket from a hash. */
+    uint64_t mask_ = 0;
+    /*!
+     * @details
+     * Indicates that @ref buckets_ and @ref mask_ are set. It is set last so that a thread seeing it
+     * also sees them.
+     */
+    std::atomic<bool> allocated_ = false;
+    /*! @details Protects the allocation of @ref buckets_ by several searches starting at the same time. */
+    std::mutex allocation_mutex_;
+    /*! @details The size of the table in MB. */
+    std::size_t size_mb_;
+    /*!
+     * @details
+     * The generation of the current search. Only its 6 lowest bits are used.
+     * Several searches sharing the table can start at the same time.
+     */
+    std::atomic<uint8_t> generation_ = 0;
+
+    /*! @details Allocates @ref buckets_ if it has not been done yet. It can be called by several threads at once. */
+    void allocate();
+    /*! @details Empties all the entries of @ref buckets_, which must be allocated. */
+    void clearEntries();
+
+ public:
+    /*!
+     * @details Construct the table. The memory is only allocated when the table is used for the first time.
+     * @param size_mb The size of the table in MB.
+     */
+    explicit TranspositionTable(const std::size_t &size_mb = DEFAULT_TRANSPOSITION_TABLE_SIZE_MB);
+
+    /*!
+     * @details
+     * Changes the size of the table. The content of the table is lost.
+     * It must not be called while a search is running.
+     * @param size_mb The size of the table in MB. It is rounded down to a power of two number of buckets.
+     */
+    void resize(const std::size_t &size_mb);
+    /*!
+     * @details Returns \ref size_mb_.
+     * @return @ref size_mb_.
+     */
+    std::size_t getSizeMB() const;
+
+    /*! @details Removes all the entries of the table. It must not be called while a search is running. */
+    void clear();
+    /*!
+     * @details
+     * Indicates that a new search starts. The entries of the previous searches are kept
+     * but they are replaced first. Several searches can start at the same time (see AlphaBeta::search).
+     */
+    void newSearch();
+
+    /*!
+     * @details Looks for a position in the table.
+     * @param hash The hash of the position.
+     * @param data Set to the content of the entry if the position is found.
+     * @return True iff the position has been found.
+     * @sa store
+     */
+    bool probe(const uint_fast64_t &hash, Data *data) const;
+
+    /*!
+     * @details Stores the result of a search in the table.
+     * @param hash The hash of the position.
+     * @param value The value computed for this position.
+     * @param depth The depth used to compute @ref value.
+     * @param bound Indicates if @ref value is exact, a lower bound or an upper bound.
+     * @param move The best move found for this position (0 if none).
+     * @sa probe
+     */
+    void store(const uint_fast64_t &hash,
+               const score_t &value,
+               const int &depth,
+               const Bound &bound,
+               const uint_fast64_t &move);
+};
+
+#endif  // SOLVERS_ALPHABETA_INCLUDE_TRANSPOSITIONTABLE_HPP_
@@ -0,0 +1,99 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * @file WorkStealingQueues.hpp
+ * @brief Work-stealing queues declaration.
+ *
+ * Declaration of the WorkStealingQueues Class which shares tasks between threads.
+ *
+ */
+
+#ifndef SOLVERS_ALPHABETA_INCLUDE_WORKSTEALINGQUEUES_HPP_
+#define SOLVERS_ALPHABETA_INCLUDE_WORKSTEALINGQUEUES_HPP_
+
+/* C++ libraries */
+#include <deque>
+#include <mutex>
+#include <vector>
+
+/*!
+ * @brief
+ * The WorkStealingQueues class gives each thread its own queue of tasks.
+ * A thread pushes and pops the tasks it creates at the back of its queue, hence it goes on with the
+ * last task it has created. An idle thread steals the tasks of the other ones at the front of their queues,
+ * i.e., the oldest ones, so that the threads seldom compete for the same end of a queue.
+ * @tparam Task The type of the tasks.
+ */
+template <typename Task>
+class WorkStealingQueues {
+ private:
+    /*! @details The queue of a thread. */
+    struct Queue {
+        /*! @details Protects @ref tasks. */
+        std::mutex mutex;
+        /*! @details The tasks. */
+        std::deque<Task> tasks;
+    };
+
+    /*! @details The queue of each thread. */
+    std::vector<Queue> queues_;
+
+ public:
+    /*!
+     * @details Creates empty queues.
+     * @param number_of_queues The number of threads sharing the tasks.
+     */
+    explicit WorkStealingQueues(const int &number_of_queues) : queues_(number_of_queues) {}
+
+    /*!
+     * @details Adds a task to the queue of a thread.
+     * @param queue The index of the thread.
+     * @param task The task.
+     */
+    void push(const int &queue, const Task &task) {
+        std::lock_guard<std::mutex> lock(queues_[queue].mutex);
+        queues_[queue].tasks.push_back(task);
+    }
+
+    /*!
+     * @details Takes the last task added to the queue of a thread.
+     * @param queue The index of the thread.
+     * @param task The task taken.
+     * @return True iff a task has been taken.
+     */
+    bool pop(const int &queue, Task &task) {
+        std::lock_guard<std::mutex> lock(queues_[queue].mutex);
+        if (queues_[queue].tasks.empty())
+            return false;
+        task = queues_[queue].tasks.back();
+        queues_[queue].tasks.pop_back();
+        return true;
+    }
+
+    /*!
+     * @details Takes the oldest task of the queue of another thread.
+     * The queues are visited from the one following the thief's so that the thieves do not all target the same one.
+     * @param thief The index of the thread looking for a task.
+     * @param task The task taken.
+     * @return True iff a task has been taken.
+     */
+    bool steal(const int &thief, Task &task) {
+        const int number_of_queues = static_cast<int>(queues_.size());
+        for (int i = 1; i < number_of_queues; ++i) {
+            Queue &victim = queues_[(thief + i) % number_of_queues];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.tasks.empty())
+                continue;
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            return true;
+        }
+        return false;
+    }
+};
+
+#endif  // SOLVERS_ALPHABETA_INCLUDE_WORKSTEALINGQUEUES_HPP_
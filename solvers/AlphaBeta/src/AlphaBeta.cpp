@@ -12,12 +12,25 @@
  *
  */
 
-#define PLUS_INFTY (20)
-#define MINUS_INFTY (-20)
-#define DRAW_VALUE (10)
+#define PLUS_INFTY (WIN_SCORE)
+#define MINUS_INFTY (-WIN_SCORE)
+#define DRAW_VALUE (DRAW_SCORE)
 
-/* Set -1 to disable it/ */
-#define MAX_TREE_WIDTH (10)
+/* A move that produced a cut-off counts HISTORY_WEIGHT times more than the whole static score range. */
+#define HISTORY_WEIGHT (4)
+
+/* Half width of the first aspiration window (0.05). It is doubled each time the value falls outside of the window. */
+#define ASPIRATION_WINDOW (SCORE_SCALE / 20)
+
+/* Maximum number of null window searches done by MTD(f) for a search. */
+#define MTDF_MAX_PASSES (32)
+
+/* The clock is read every TIME_CHECK_INTERVAL nodes during a timed search. It must be a power of 2. */
+#define TIME_CHECK_INTERVAL (1024)
+
+/* Values depend on the player we are playing for. This key is xored to the hash of the positions
+ * searched for Black so that both players can share the transposition table. */
+#define BLACK_PERSPECTIVE_KEY (0x9E3779B97F4A7C15)
 
 
 /* AlphaBeta.hpp */
@@ -36,15 +49,21 @@
 #include <map>
 #include <set>
 #include <algorithm>
+#include <cmath>
 #include <unordered_map>
 #include <utility>
 #include <fstream>
 #include <iomanip>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <chrono>
 #include <boost/unordered_map.hpp>
 
 /* Other */
 #include "Types.hpp"
 #include "ChineseCheckers.hpp"
+#include "TranspositionTable.hpp"
 
 AlphaBeta::AlphaBeta() {
     /* This constructor initializes the AlphaBeta class with pre-computed values that can be used
@@ -77,7 +96,10 @@ AlphaBeta::AlphaBeta() {
         36.0/588, 37.0/588, 40.0/588, 45.0/588, 52.0/588, 62.0/588, 72.0/588, 85.0/588,
         49.0/588, 50.0/588, 53.0/588, 58.0/588, 65.0/588, 74.0/588, 85.0/588, 98.0/588});
 
-    loadOpenings();
+    /* The search uses the weights as scores. */
+    player_to_win_score_  = quantizeWeights(player_to_win_value_);
+    player_to_lose_score_ = quantizeWeights(player_to_lose_value_);
+    computeRowWeights();
 }
 
 AlphaBeta::AlphaBeta(const std::vector<double> &player_to_win_value_,
@@ -85,16 +107,99 @@ AlphaBeta::AlphaBeta(const std::vector<double> &player_to_win_value_,
     /* Set member variables equal to the passed in values */
     this->player_to_win_value_ = player_to_win_value_;
     this->player_to_lose_value_ = player_to_lose_value_;
+    /* The search uses the weights as scores. */
+    player_to_win_score_  = quantizeWeights(player_to_win_value_);
+    player_to_lose_score_ = quantizeWeights(player_to_lose_value_);
+    computeRowWeights();
+}
+
+AlphaBeta::AlphaBeta(const AlphaBeta &other) : AlphaBeta(other, std::make_shared<TranspositionTable>(
+                                                       other.transposition_table_->getSizeMB())) {
+    /* The transposition table and the helpers are not shared with the original object. */
+}
 
-    loadOpenings();
+AlphaBeta::AlphaBeta(const AlphaBeta &other,
+                     const std::shared_ptr<TranspositionTable> &transposition_table)
+    : ChineseCheckers(other),
+      player_to_win_value_(other.player_to_win_value_),
+      player_to_lose_value_(other.player_to_lose_value_),
+      player_to_win_score_(other.player_to_win_score_),
+      player_to_lose_score_(other.player_to_lose_score_),
+      win_rows_(other.win_rows_),
+      lose_rows_(other.lose_rows_),
+      maximizing_player_(other.maximizing_player_),
+      best_move_(other.best_move_),
+      transposition_table_(transposition_table),
+      opening_(other.opening_),
+      use_neural_network_ordering_(other.use_neural_network_ordering_),
+      model_(other.model_),
+      heuristic_value_(other.heuristic_value_),
+      fullDepth_(other.fullDepth_),
+      number_of_threads_(other.number_of_threads_),
+      use_ybwc_(other.use_ybwc_),
+      use_killers_and_history_(other.use_killers_and_history_),
+      use_flood_fill_(other.use_flood_fill_),
+      use_pvs_(other.use_pvs_),
+      use_aspiration_windows_(other.use_aspiration_windows_),
+      use_mtdf_(other.use_mtdf_),
+      previous_value_(other.previous_value_),
+      previous_value_known_(other.previous_value_known_),
+      tree_width_(other.tree_width_),
+      use_late_move_reductions_(other.use_late_move_reductions_),
+      late_move_reductions_(other.late_move_reductions_),
+      use_quiescence_(other.use_quiescence_),
+      quiescence_depth_(other.quiescence_depth_),
+      quiescence_margin_(other.quiescence_margin_),
+      use_win_solver_(other.use_win_solver_),
+      win_solver_depth_(other.win_solver_depth_) {
+    /* The helpers are not shared with the original object. */
 }
 
-void AlphaBeta::availableMoves(std::set<uint_fast64_t, decltype(comp_move_)> &result) {
+AlphaBeta::~AlphaBeta() {
+    stopPondering();
+    stopHelperThreads();
+}
+
+void AlphaBeta::availableMoves(MoveList &result) {
     /* This function calculates all available moves for the current player
-     * and stores them in the result vector.
-     * The result vector is passed as a reference so that it can be modified
+     * and adds them to the result list.
+     * The result list is passed as a reference so that it can be modified
      * inside the function. */
 
+    /* This part of the code handles the case of jump moves. */
+    if (use_flood_fill_)
+        availableJumpsFloodFill(result);
+    else
+        availableJumpsBFS(result);
+
+    /* A bitboard that represents all the pawns on the board (both black and white). */
+    const uint_fast64_t bit_boards_all  = (bit_boards_.White | bit_boards_.Black);
+    /* A bitboard that represents the current player's pawns. */
+    const uint_fast64_t currentBitBoard = who_is_to_play_ ? bit_boards_.Black : bit_boards_.White;
+    /* player_to_win_value_ is seen from the perspective of the black player.
+     * Xoring an index with 63 is equivalent to 63 - index which gives the perspective of the white player. */
+    const int perspective = who_is_to_play_ ? 0 : 63;
+    /* The value of the square of the pawn being moved. A move is scored by the value it makes the pawn lose. */
+    score_t root_value;
+
+    /* This part of the code handles the case of not jump moves. */
+    for (int i = 0; i < 64; ++i) {
+        if ((un_64_ << i) & currentBitBoard) {
+            root_value = player_to_win_score_[i ^ perspective];
+            /* Iterates over each of the direct neighbors of the pawn which are not occupied
+             * by any pawn (White or Black) using the direct_neighbours_ data structure. */
+            for (uint_fast64_t free_neighbours = direct_neighbours_[i] & ~bit_boards_all;
+                 free_neighbours;
+                 free_neighbours &= free_neighbours - 1) {
+                /* The move is valid and is added to the result. */
+                result.add((un_64_ << i) | (free_neighbours & -free_neighbours),
+                           root_value - player_to_win_score_[__builtin_ctzll(free_neighbours) ^ perspective]);
+            }
+        }
+    }
+}
+
+void AlphaBeta::availableJumpsBFS(MoveList &result) {
     /* A bitboard that keeps track of whether we have computed the possible elementary
      * moves for each position or not. */
     uint_fast64_t computed_possible_elementary_move = 0;
@@ -102,10 +207,11 @@ void AlphaBeta::availableMoves(std::set<uint_fast64_t, decltype(comp_move_)> &re
     const uint_fast64_t bit_boards_all  = (bit_boards_.White | bit_boards_.Black);
     /* A bitboard that represents the current player's pawns. */
     const uint_fast64_t currentBitBoard = who_is_to_play_ ? bit_boards_.Black : bit_boards_.White;
-
-
-
-    /* This part of the code handles the case of jump moves. */
+    /* player_to_win_value_ is seen from the perspective of the black player.
+     * Xoring an index with 63 is equivalent to 63 - index which gives the perspective of the white player. */
+    const int perspective = who_is_to_play_ ? 0 : 63;
+    /* The value of the square of the pawn being moved. A move is scored by the value it makes the pawn lose. */
+    score_t root_value;
 
 
     /*
@@ -146,6 +252,7 @@ void AlphaBeta::availableMoves(std::set<uint_fast64_t, decltype(comp_move_)> &re
 
         /* Get the coordinates of the root. */
         root_idx = __builtin_ctzll(root);
+        root_value = player_to_win_score_[root_idx ^ perspective];
         /* Calculate the row and column indices of the root. */
         i_root_times_2 = (root_idx >> 3) << 1;
         j_root_times_2 = (root_idx & 7) << 1;
@@ -166,18 +273,17 @@ void AlphaBeta::availableMoves(std::set<uint_fast64_t, decltype(comp_move_)> &re
              * compute them and store them in the possible_elementary_move map. */
             if (!(computed_possible_elementary_move & v)) {
                 /* Loop over all possible jumps for the current node. */
-                for (auto pPossibleJumps = k_neighbours_[__builtin_ctzll(v)].begin();
-                     pPossibleJumps != k_neighbours_[__builtin_ctzll(v)].end();
-                     ++pPossibleJumps) {
-                    for (auto pPossibleJump = pPossibleJumps->begin();
-                         pPossibleJump != pPossibleJumps->end();
-                         ++pPossibleJump) {
+                for (const auto &possibleJumps : k_neighbours_[idx]) {
+                    for (const JumpEntry &possibleJump : possibleJumps) {
+                        /* There is no farther jump in this direction. */
+                        if (!possibleJump.pivot)
+                            break;
 
                         /* Check if there is a pawn to jump over and if the jump is valid. */
-                        if ((bit_boards_all & pPossibleJump->first.first)
-                            && !(bit_boards_all & (pPossibleJump->second | pPossibleJump->first.second))) {
+                        if ((bit_boards_all & possibleJump.pivot)
+                            && !(bit_boards_all & possibleJump.line)) {
                             /* Store the possible elementary moves for the current node. */
-                            possible_elementary_move[__builtin_ctzll(v)].emplace_back(pPossibleJump->first.second);
+                            possible_elementary_move[idx].emplace_back(possibleJump.landing);
                             break;
                         }
                     }
@@ -202,32 +308,91 @@ void AlphaBeta::availableMoves(std::set<uint_fast64_t, decltype(comp_move_)> &re
                     queue    |= neig;
                     explored |= neig;
                     /* Add the move to the result. */
-                    result.insert(root | neig);
+                    result.add(root | neig, root_value - player_to_win_score_[neig_idx ^ perspective]);
                 }
             }
         }
     }
+}
 
+void AlphaBeta::availableJumpsFloodFill(MoveList &result) {
+    /* A bitboard that represents all the pawns on the board (both black and white). */
+    const uint_fast64_t bit_boards_all  = (bit_boards_.White | bit_boards_.Black);
+    /* A bitboard that represents the current player's pawns. */
+    const uint_fast64_t currentBitBoard = who_is_to_play_ ? bit_boards_.Black : bit_boards_.White;
+    /* player_to_win_value_ is seen from the perspective of the black player.
+     * Xoring an index with 63 is equivalent to 63 - index which gives the perspective of the white player. */
+    const int perspective = who_is_to_play_ ? 0 : 63;
 
-    /* This part of the code handles the case of not jump moves. */
-    for (int i = 0; i < 64; ++i) {
-        if ((un_64_ << i) & currentBitBoard) {
-            /* Iterates over each of the direct neighbors of the pawn
-            　* using the direct_neighbours_ data structure. */
-            for (const auto &neig : direct_neighbours_[i]) {
-                /* If the neighbor position is not occupied by any pawn (White or Black),
-                 * then the move is valid and is added to the result vector. */
-                if (!(bit_boards_all & neig))
-                    result.insert((un_64_ << i) | neig);
+    /*
+     * jump_sources[dir][k - 1] is the set of the squares from which a pawn can jump in the direction dir
+     * over a pawn at distance k: the first pawn met in this direction is at distance k
+     * and the k squares after it are empty.
+     * It only depends on the position, so it is computed once for all the pawns.
+     */
+    std::array<std::array<uint_fast64_t, MAX_JUMP_DISTANCE>, NUMBER_OF_DIRECTIONS> jump_sources;
+    for (int dir = 0; dir < NUMBER_OF_DIRECTIONS; ++dir) {
+        /* The squares whose k - 1 first squares in the direction dir are empty. */
+        uint_fast64_t empty_before = ~static_cast<uint_fast64_t>(0);
+        for (int k = 1; k <= MAX_JUMP_DISTANCE; ++k) {
+            uint_fast64_t sources = empty_before & shiftBitBoardBack(bit_boards_all, dir, k);
+            for (int l = k + 1; l <= (k << 1); ++l)
+                sources &= shiftBitBoardBack(~bit_boards_all, dir, l);
+            jump_sources[dir][k - 1] = sources;
+            empty_before &= shiftBitBoardBack(~bit_boards_all, dir, k);
+        }
+    }
+
+    /* The current root node. */
+    uint_fast64_t root;
+    /* A bitboard that represents the remaining pawns to be processed. */
+    uint_fast64_t pawnPositionMask = currentBitBoard;
+    /* The squares reached by the pawn, the ones reached by the last jumps and the ones reached by the next jumps. */
+    uint_fast64_t reached, frontier, next;
+    /* The value of the square of the pawn being moved. A move is scored by the value it makes the pawn lose. */
+    score_t root_value;
+
+    /* Loop over all pawns of the current player. */
+    for (root = pawnPositionMask & -pawnPositionMask;
+                pawnPositionMask & -pawnPositionMask;
+         root = pawnPositionMask & -pawnPositionMask) {
+        /* Remove the current root from the mask of pawn positions. */
+        pawnPositionMask ^= root;
+        root_value = player_to_win_score_[__builtin_ctzll(root) ^ perspective];
+
+        /* Flood fill: all the squares reachable by one more jump are found at once. */
+        reached  = root;
+        frontier = root;
+        while (frontier) {
+            next = 0;
+            for (int dir = 0; dir < NUMBER_OF_DIRECTIONS; ++dir) {
+                for (int k = 1; k <= MAX_JUMP_DISTANCE; ++k) {
+                    /* The moving pawn stays on its original square during the jumps,
+                     * but it can't jump over itself. */
+                    next |= shiftBitBoard(frontier
+                                          & jump_sources[dir][k - 1]
+                                          & ~shiftBitBoardBack(root, dir, k),
+                                          dir,
+                                          k << 1);
+                }
             }
+            frontier = next & ~reached;
+            reached |= frontier;
+        }
+
+        /* Add the moves to the result. */
+        for (uint_fast64_t landings = reached ^ root; landings; landings &= landings - 1) {
+            result.add(root | (landings & -landings),
+                       root_value - player_to_win_score_[__builtin_ctzll(landings) ^ perspective]);
         }
     }
 }
 
 ListOfPositionType AlphaBeta::getMove(const int &depth, const double &alpha, const double &beta) {
     /* Checks if the current state of the game is in the opening book. */
-    if (opening_[who_is_to_play_].find(bit_boards_) != opening_[who_is_to_play_].end())
-        return retrieveMoves(opening_[who_is_to_play_][bit_boards_]);
+    const auto opening = (*opening_)[who_is_to_play_].find(bit_boards_);
+    if (opening != (*opening_)[who_is_to_play_].end())
+        return retrieveMoves(opening->second);
 
     /* If the current state is not in the opening book, the getMove64 function
      * is called with the same inputs to search for the best move. */
@@ -236,6 +401,8 @@ ListOfPositionType AlphaBeta::getMove(const int &depth, const double &alpha, con
 }
 
 uint_fast64_t AlphaBeta::getMove64(const int &depth) {
+    /* The transposition table filled by the pondering is kept, whether the expected reply was played or not. */
+    const bool ponder_hit = stopPondering();
     /* Set the maximizing player to be the one who is to play,
      * i.e., the player who is currently making a move. */
     maximizing_player_ = who_is_to_play_;
@@ -249,237 +416,768 @@ uint_fast64_t AlphaBeta::getMove64(const int &depth) {
     computeAndSetZobristHash();
     uint_fast64_t hash = zobrist_hash_;
 
-    /* Clear the transposition table. */
-    transposition_table_.clear();
+    /* Age the entries of the previous searches in the transposition table. */
+    transposition_table_->newSearch();
+    newSearchOrdering();
     /* Reset the best_move_ variable to zero. */
     best_move_ = 0;
+    /* Allow the search to run. */
+    stop_search_->store(false);
+
+    /* In the late game, the shortest forced win is looked for first. */
+    distance_to_win_ = -1;
+    completed_depth_ = 0;
+    if (use_win_solver_ && solveWin(win_solver_depth_) > 0)
+        return best_move_;
+
+    /* On a ponder hit, the search continues from the iterations completed while the opponent was thinking. */
+    if (ponder_hit) {
+        const int ponder_depth = ponder_engine_->ponder_depth_;
+        previous_value_[maximizing_player_]       = ponder_engine_->ponder_value_;
+        previous_value_known_[maximizing_player_] = true;
+        /* The result is only used once. */
+        ponder_engine_->ponder_depth_ = 0;
+        /* The pondering went deep enough or found a win, which a deeper search would only find longer. */
+        if (ponder_depth >= depth || previous_value_[maximizing_player_] == MINUS_INFTY) {
+            best_move_       = ponder_engine_->ponder_move_;
+            completed_depth_ = ponder_depth;
+            return best_move_;
+        }
+        /* Otherwise, the best move of the pondering is the move of the root stored in the transposition table,
+         * hence it is searched first, and its value is the first guess of the search. */
+    }
+
+    /* Do a full search, helped by the other threads if there are some. */
+    SEARCH_STATISTIC(const auto iteration_start = std::chrono::steady_clock::now());
+    startHelperThreads(depth, hash);
+    score_t val;
+    if (use_mtdf_)
+        val = mtdfSearch(depth,
+                         previous_value_known_[maximizing_player_] ? previous_value_[maximizing_player_]
+                                                                   : heuristic_value_,
+                         hash);
+    else if (use_aspiration_windows_ && previous_value_known_[maximizing_player_])
+        val = aspirationSearch(depth, previous_value_[maximizing_player_], hash);
+    else
+        val = AlphaBetaEval(depth,
+                            MINUS_INFTY,
+                            PLUS_INFTY,
+                            false,
+                            true,
+                            hash);
+    stopHelperThreads();
+    SEARCH_STATISTIC(recordIteration(depth, 0, iteration_start));
+    completed_depth_ = depth;
+    previous_value_[maximizing_player_]       = val;
+    previous_value_known_[maximizing_player_] = true;
+    return best_move_;
+}
+
+ListOfPositionType AlphaBeta::getMoveWithin(const int &time_ms) {
+    /* Checks if the current state of the game is in the opening book. */
+    const auto opening = (*opening_)[who_is_to_play_].find(bit_boards_);
+    if (opening != (*opening_)[who_is_to_play_].end())
+        return retrieveMoves(opening->second);
 
-    int d = 1;
-    /* Start a loop that will execute at least once and will continue
-     * until the game is won or the maximum search depth is reached.
-     * This is a use of zero width windows heuristic. It makes the end-game
-     * faster and improves a lot the quality of the player. */
-    do {
-         /* If the returned value is -infinity, then the game is won,
-          * and the function returns the best_move_ found so far. */
-        if (AlphaBetaEval(d,
-                          MINUS_INFTY,
-                          MINUS_INFTY,
-                          false,
-                          true,
-                          hash) == MINUS_INFTY)
+    return retrieveMoves(getMove64Within(time_ms));
+}
+
+uint_fast64_t AlphaBeta::getMove64Within(const int &time_ms) {
+    return iterativeDeepening(MAX_SEARCH_DEPTH, time_ms);
+}
+
+SearchResult AlphaBeta::search(const Position &position, const Limits &limits) const {
+    /* The state of the search lives in its own engine, which shares the tables of this one. */
+    AlphaBeta context(*this, transposition_table_);
+    context.setPosition(position);
+    /* The search starts cold: the values of the previous searches of this engine are about other positions. */
+    context.previous_value_known_ = {false, false};
+
+    SearchResult result;
+    result.move       = limits.time_ms < 0 ? context.getMove64(limits.depth)
+                                           : context.iterativeDeepening(limits.depth, limits.time_ms);
+    result.value      = scoreToValue(context.distance_to_win_ > 0 ? MINUS_INFTY
+                                                                  : context.previous_value_[context.maximizing_player_]);
+    result.depth      = context.completed_depth_;
+    result.statistics = context.getSearchStatistics();
+    return result;
+}
+
+uint_fast64_t AlphaBeta::iterativeDeepening(const int &max_depth, const int &time_ms) {
+    /* The transposition table filled by the pondering is kept, whether the expected reply was played or not. */
+    const bool ponder_hit = stopPondering();
+    const auto start = std::chrono::steady_clock::now();
+    deadline_ = start + std::chrono::milliseconds(time_ms);
+
+    maximizing_player_ = who_is_to_play_;
+    heuristic_value_   = heuristicValue();
+
+    computeAndSetZobristHash();
+    uint_fast64_t hash = zobrist_hash_;
+
+    transposition_table_->newSearch();
+    newSearchOrdering();
+    stop_search_->store(false);
+
+    /* In the late game, the shortest forced win is looked for first, within half of the time budget. */
+    distance_to_win_ = -1;
+    completed_depth_ = 0;
+    if (use_win_solver_) {
+        deadline_     = start + std::chrono::milliseconds(time_ms / 2);
+        timed_search_ = true;
+        const int distance_to_win = solveWin(win_solver_depth_);
+        timed_search_ = false;
+        deadline_     = start + std::chrono::milliseconds(time_ms);
+        if (distance_to_win > 0)
             return best_move_;
-        /* Increase the search depth by 2 because an adversary move should
-         * not be the reason of a win. */
-        d += 2;
-    }  while (won_[maximizing_player_] && (d <= depth + 2));
-
-    /* Do a full search */
-    double val = AlphaBetaEval(depth,
-                               MINUS_INFTY,
-                               PLUS_INFTY,
-                               false,
-                               true,
-                               hash);
-
-    /* Update the won_ array to reflect whether the maximizing
-     * player won the game in the current search. */
-    won_[maximizing_player_] = (!won_[maximizing_player_]
-                                && (val == MINUS_INFTY));
+    }
+
+    /* The best move of the last completed iteration. */
+    uint_fast64_t completed_move = 0;
+    /* The first iteration searched. */
+    int first_depth = 1;
+    /* On a ponder hit, the iterations completed while the opponent was thinking are not searched again. */
+    if (ponder_hit) {
+        completed_move   = ponder_engine_->ponder_move_;
+        first_depth      = ponder_engine_->ponder_depth_ + 1;
+        completed_depth_ = ponder_engine_->ponder_depth_;
+        previous_value_[maximizing_player_]       = ponder_engine_->ponder_value_;
+        previous_value_known_[maximizing_player_] = true;
+        /* The result is only used once. */
+        ponder_engine_->ponder_depth_ = 0;
+        /* A win has been found: a deeper search would only find a longer one. */
+        if (previous_value_[maximizing_player_] == MINUS_INFTY)
+            first_depth = MAX_SEARCH_DEPTH + 1;
+    }
+    for (int depth = first_depth; depth <= max_depth; ++depth) {
+        fullDepth_    = depth;
+        best_move_    = 0;
+        /* The first iteration is never interrupted. */
+        timed_search_ = depth > 1;
+        SEARCH_STATISTIC(const uint64_t iteration_nodes = nodes_;
+                         const auto iteration_start = std::chrono::steady_clock::now());
+
+        startHelperThreads(depth, hash);
+        /* The value of the previous iteration is a good guess of the value of this one. */
+        score_t val;
+        if (use_mtdf_)
+            val = mtdfSearch(depth,
+                             previous_value_known_[maximizing_player_] ? previous_value_[maximizing_player_]
+                                                                       : heuristic_value_,
+                             hash);
+        else if (use_aspiration_windows_ && depth > 1)
+            val = aspirationSearch(depth, previous_value_[maximizing_player_], hash);
+        else
+            val = AlphaBetaEval(depth,
+                                MINUS_INFTY,
+                                PLUS_INFTY,
+                                false,
+                                true,
+                                hash);
+        /* The helpers are stopped with the same flag: check it before stopping them. */
+        const bool aborted = stop_search_->load();
+        stopHelperThreads();
+        stop_search_->store(false);
+
+        if (aborted)
+            break;
+        SEARCH_STATISTIC(recordIteration(depth, iteration_nodes, iteration_start));
+        completed_move   = best_move_;
+        completed_depth_ = depth;
+        previous_value_[maximizing_player_]       = val;
+        previous_value_known_[maximizing_player_] = true;
+
+        /* A win has been found: a deeper search would only find a longer one. */
+        if (val == MINUS_INFTY)
+            break;
+        /* The next iteration is much longer than this one. Do not start it if it cannot be completed. */
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        if (start + 2 * elapsed >= deadline_)
+            break;
+    }
+    timed_search_ = false;
+
+    best_move_ = completed_move;
     return best_move_;
 }
 
-const double AlphaBeta::AlphaBetaEval(const int &depth,
-                             double alpha,
-                             double beta,
-                             const bool &maximizingPlayer,
-                             const bool &keepMove,
-                             uint_fast64_t hash) {
-    /* Check if the current node is a terminating node, i.e., if the game has been won by one of the players.
-     * For the player who is to play, check if they have won the game by occupying all the winning positions for their color.
-     * If so, return the maximum score (PLUS_INFINITY) if the player is the maximizing player, and the minimum score
-     * (MINUS_INFINITY) otherwise.
-     * For the opponent player, check if they have won the game by occupying all the winning positions for their color.
-     * If so, return the minimum score (MINUS_INFINITY) if the player is the maximizing player, and the maximum score
-     * (PLUS_INFINITY) otherwise.
-     */
-    if (who_is_to_play_) {
-        if ((bit_boards_.White & winning_positions_white_) /* Did white win ? */
-            && ((bit_boards_.White | bit_boards_.Black) & winning_positions_white_)
-                    == winning_positions_white_) {
-            /* The game has been won by White. */
-            return maximizing_player_ ? PLUS_INFTY : MINUS_INFTY;
-        }
-    } else if (     (bit_boards_.Black & winning_positions_black_) /* Did black win ? */
-                && ((bit_boards_.White | bit_boards_.Black) & winning_positions_black_)
-                        == winning_positions_black_) {
-        /* The game has been won by Black. */
-        return maximizing_player_ ? MINUS_INFTY : PLUS_INFTY;
-    }
-
-    if (std::find(positions_seen_.begin(), positions_seen_.end(), zobrist_hash_)
-        == positions_seen_.end()) { /* Is there a draw ? */
-        positions_seen_.push_back(zobrist_hash_);
-        /* The game ended in a draw. */
-        return DRAW_VALUE;
-    } else { /* the game is not over. */
-        if (depth == 0)
-            return heuristic_value_;
+int AlphaBeta::solveWin(const int &max_plies) {
+    distance_to_win_     = -1;
+    win_solver_attacker_ = who_is_to_play_;
+    win_solver_nodes_    = 0;
+    computeAndSetZobristHash();
+    if (proof_table_.size() > PROOF_TABLE_SIZE)
+        proof_table_.clear();
+
+    /* The attacker plays the odd plies: a win is always an odd number of plies long. */
+    for (int plies = 1; plies <= max_plies; plies += 2) {
+        if (proveWin(plies)) {
+            best_move_       = proof_table_[win_solver_attacker_ ? zobrist_hash_ ^ BLACK_PERSPECTIVE_KEY
+                                                                 : zobrist_hash_].move;
+            distance_to_win_ = plies;
+            return plies;
+        }
+        if (win_solver_nodes_ >= WIN_SOLVER_MAX_NODES)
+            break;
+    }
+    return -1;
+}
+
+bool AlphaBeta::proveWin(const int &plies) {
+    ++win_solver_nodes_;
+    /* A timed search stops the solver like it stops the search: the budget of nodes is exhausted at once. */
+    if (timed_search_
+        && !(win_solver_nodes_ & (TIME_CHECK_INTERVAL - 1))
+        && std::chrono::steady_clock::now() >= deadline_)
+        win_solver_nodes_ = WIN_SOLVER_MAX_NODES;
+    if (win_solver_nodes_ >= WIN_SOLVER_MAX_NODES)
+        return false;
+
+    /* The same position can be proven for each player: the attacker is part of the key. */
+    const uint_fast64_t key = win_solver_attacker_ ? zobrist_hash_ ^ BLACK_PERSPECTIVE_KEY : zobrist_hash_;
+    const auto entry = proof_table_.find(key);
+    if (entry != proof_table_.end()) {
+        if (entry->second.proven && entry->second.proven <= plies)
+            return true;
+        if (entry->second.disproven >= plies)
+            return false;
+    }
+
+    const bool attacker = who_is_to_play_ == win_solver_attacker_;
+    const uint_fast64_t winning_positions = win_solver_attacker_ ? winning_positions_black_
+                                                                 : winning_positions_white_;
+    /* Each move of the attacker fills at most one empty winning position.
+     * It needs at least one move if none of its pawns has reached the winning positions. */
+    const int attacker_moves = attacker ? (plies + 1) / 2 : plies / 2;
+    const int empty_winning_positions = __builtin_popcountll(winning_positions
+                                                             & ~(bit_boards_.White | bit_boards_.Black));
+    const bool has_reached_winning_positions = (win_solver_attacker_ ? bit_boards_.Black : bit_boards_.White)
+                                               & winning_positions;
+    if (std::max(empty_winning_positions, has_reached_winning_positions ? 0 : 1) > attacker_moves) {
+        ProofEntry &stored = proof_table_[key];
+        stored.disproven = std::max(static_cast<int>(stored.disproven), plies);
+        return false;
+    }
+    /* The attacker has no move to spare: each of its moves must fill an empty winning position. */
+    const bool no_move_to_spare = attacker && empty_winning_positions == attacker_moves;
+
+    MoveList possible_moves;
+    availableMoves(possible_moves);
+    /* The attacker tries the moves filling a winning position first,
+     * the defender tries the moves leaving the winning positions of the attacker first. */
+    const uint_fast64_t currentBitBoard = who_is_to_play_ ? bit_boards_.Black : bit_boards_.White;
+    for (int index = 0; index < possible_moves.size(); ++index) {
+        const uint_fast64_t move = possible_moves[index];
+        if (attacker ? (move & ~currentBitBoard & winning_positions) && !(move & currentBitBoard & winning_positions)
+                     : (move & currentBitBoard & winning_positions))
+            possible_moves.score(index) += PLUS_INFTY;
+    }
+
+    /* An attacker node is proven by one move, a defender node by all its moves. */
+    bool proven = !attacker;
+    bool legal_move = false;
+    uint_fast64_t winning_move = 0;
+    for (int index = 0; index < possible_moves.size(); ++index) {
+        const uint_fast64_t move = possible_moves.pickBest(index);
+        /* The next moves do not fill a winning position either. */
+        if (no_move_to_spare && possible_moves.score(index) < PLUS_INFTY / 2)
+            break;
 
-        /* Use a transposition table to avoid redundant computation. */
-        it_transposition_table_ = transposition_table_.find(hash);
-        if (it_transposition_table_ != transposition_table_.end()
-            && it_transposition_table_->second.second == depth) {
-            /* Return the stored value from the transposition table if available. */
-            return it_transposition_table_->second.first;
+        moveWithoutVerification(move);
+        if (isPositionIllegal()) {
+            undoMoveWithoutVerification(move);
+            continue;
+        }
+        legal_move = true;
+        /* A player who has just won ends the game. */
+        bool result;
+        if (hasWon(who_is_to_play_ ^ 1))
+            result = attacker;
+        else
+            result = plies > 1 && proveWin(plies - 1);
+        undoMoveWithoutVerification(move);
+
+        /* The search of the child may have been stopped: nothing is known. */
+        if (!result && win_solver_nodes_ >= WIN_SOLVER_MAX_NODES)
+            return false;
+        if (attacker && result) {
+            proven       = true;
+            winning_move = move;
+            break;
+        }
+        if (!attacker && !result) {
+            proven = false;
+            break;
         }
     }
+    proven = proven && legal_move;
+
+    ProofEntry &stored = proof_table_[key];
+    if (proven && (!stored.proven || plies < stored.proven)) {
+        stored.proven = plies;
+        stored.move   = winning_move;
+    } else if (!proven) {
+        stored.disproven = std::max(static_cast<int>(stored.disproven), plies);
+    }
+    return proven;
+}
 
-    /* Retrieve the possibles moves. */
-    std::set<uint_fast64_t, decltype(comp_move_)> possible_moves(comp_move_);
+std::vector<RootMove> AlphaBeta::multiPVSearch(const int &depth, const int &number_of_pvs) {
+    stopPondering();
+    maximizing_player_ = who_is_to_play_;
+    heuristic_value_   = heuristicValue();
+    computeAndSetZobristHash();
+
+    transposition_table_->newSearch();
+    newSearchOrdering();
+    stop_search_->store(false);
+
+    /* The legal moves of the root, in the order given by availableMoves. */
+    MoveList possible_moves;
     availableMoves(possible_moves);
+    std::vector<RootMove> root_moves;
+    for (int index = 0; index < possible_moves.size(); ++index) {
+        const uint_fast64_t move = possible_moves.pickBest(index);
+        moveWithoutVerification(move);
+        if (!isPositionIllegal())
+            root_moves.push_back({move, 0, true, {move}});
+        undoMoveWithoutVerification(move);
+    }
+    /* The best move is always needed. */
+    const int number_of_exact_moves = number_of_pvs == -1 ? root_moves.size()
+                                                          : std::clamp(number_of_pvs, 1, std::max(
+                                                                  static_cast<int>(root_moves.size()), 1));
+
+    /* The values of the exact moves searched so far by the current iteration. */
+    std::vector<score_t> exact_values;
+    for (int d = 1; d <= depth; ++d) {
+        fullDepth_ = d;
+        exact_values.clear();
+        SEARCH_STATISTIC(const uint64_t iteration_nodes = nodes_;
+                         const auto iteration_start = std::chrono::steady_clock::now());
+        /* The best moves of the previous iteration are searched first. */
+        for (RootMove &root_move : root_moves) {
+            /* Once number_of_exact_moves moves are known, a move only needs an exact value if it is better
+             * than the worst of them. The root is a minimizing node. */
+            score_t beta = PLUS_INFTY;
+            const bool bounded = static_cast<int>(exact_values.size()) >= number_of_exact_moves;
+            if (bounded) {
+                std::nth_element(exact_values.begin(),
+                                 exact_values.begin() + number_of_exact_moves - 1,
+                                 exact_values.end());
+                beta = exact_values[number_of_exact_moves - 1];
+            }
 
-    /* Sort according to the value of the move in order to increase the number of cut-offs. */
-    if (0 && keepMove) {
-        tensorflowSortMoves(possible_moves);
-        /* Trick to sort the set using another function. */
-        if (who_is_to_play_) {
-            std::set < uint_fast64_t, decltype(comp_move_black_) > buffer(comp_move_black_);
-            std::copy(possible_moves.begin(), possible_moves.end(), std::inserter(buffer, buffer.end()));
-            possible_moves = std::move(buffer);
-        } else {
-            std::set < uint_fast64_t, decltype(comp_move_white_) > buffer(comp_move_white_);
-            std::copy(possible_moves.begin(), possible_moves.end(), std::inserter(buffer, buffer.end()));
-            possible_moves = std::move(buffer);
+            updateHeuristicValue(root_move.move);
+            moveWithoutVerification(root_move.move);
+            ++ply_;
+            root_move.value = AlphaBetaEval(d - 1,
+                                            MINUS_INFTY,
+                                            beta,
+                                            true,
+                                            false,
+                                            zobrist_hash_);
+            --ply_;
+            undoMoveWithoutVerification(root_move.move);
+            updateHeuristicValueBack(root_move.move);
+
+            root_move.exact = !bounded || root_move.value < beta;
+            if (root_move.exact)
+                exact_values.push_back(root_move.value);
         }
+        /* The exact moves come first, from the best to the worst one. */
+        std::stable_sort(root_moves.begin(), root_moves.end(), [](const RootMove &a, const RootMove &b) {
+            return a.exact != b.exact ? a.exact : a.value < b.value;
+        });
+        SEARCH_STATISTIC(recordIteration(d, iteration_nodes, iteration_start));
     }
 
-    /* Initialize the value we will return. */
-    double value = maximizingPlayer ? MINUS_INFTY - 1 : PLUS_INFTY + 1;
-    /* Create a buff used to keep the result of the recursive call. */
-    double buff;
+    /* Only the best moves are kept as exact: a move may have been exact before better ones were found. */
+    for (int index = 0; index < static_cast<int>(root_moves.size()); ++index) {
+        RootMove &root_move = root_moves[index];
+        root_move.exact = root_move.exact && index < number_of_exact_moves;
+        root_move.pv    = root_move.exact ? principalVariation(root_move.move, depth)
+                                          : std::vector<uint_fast64_t>{root_move.move};
+    }
+    best_move_ = root_moves.empty() ? 0 : root_moves.front().move;
+    return root_moves;
+}
 
-    /* We do not consider all moves in order to have a speed-up */
-    int index = 0;
-    for (const auto &move:possible_moves) {
-        if (index++ == MAX_TREE_WIDTH)
+std::vector<std::pair<ListOfPositionType, double>> AlphaBeta::analyse(const int &depth, const int &number_of_pvs) {
+    std::vector<std::pair<ListOfPositionType, double>> result;
+    for (const RootMove &root_move : multiPVSearch(depth, number_of_pvs)) {
+        if (root_move.exact)
+            result.emplace_back(retrieveMoves(root_move.move), scoreToValue(root_move.value));
+    }
+    return result;
+}
+
+std::vector<uint_fast64_t> AlphaBeta::principalVariation(const uint_fast64_t &move, const int &length) {
+    std::vector<uint_fast64_t> pv = {move};
+    moveWithoutVerification(move);
+
+    TranspositionTable::Data tt_data;
+    MoveList possible_moves;
+    while (static_cast<int>(pv.size()) < length
+           && transposition_table_->probe(maximizing_player_ ? zobrist_hash_ ^ BLACK_PERSPECTIVE_KEY : zobrist_hash_,
+                                          &tt_data)
+           && tt_data.move) {
+        /* The move may come from another position with the same key. */
+        possible_moves.clear();
+        availableMoves(possible_moves);
+        if (std::find(possible_moves.begin(), possible_moves.end(), tt_data.move) == possible_moves.end())
             break;
-        /* Update the heuristic value with the given move. */
-        updateHeuristicValue(move);
-        /* Update the hash for the current position. */
-        hash ^= zobrist_keys_moves_[who_is_to_play_][move];
+        pv.push_back(tt_data.move);
+        moveWithoutVerification(tt_data.move);
+    }
 
-        /* Apply the move to the current position. */
-        who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
-        /* Apply the move to the current position. */
-        who_is_to_play_ ^= 1;
+    /* Go back to the current position. */
+    for (auto it = pv.rbegin(); it != pv.rend(); ++it)
+        undoMoveWithoutVerification(*it);
+    return pv;
+}
 
-        /* Indicates that this position has been seen another time. */
+const score_t AlphaBeta::AlphaBetaEval(const int &depth,
+                                      score_t alpha,
+                                      score_t beta,
+                                      const bool &maximizingPlayer,
+                                      const bool &keepMove,
+                                      uint_fast64_t hash) {
+    ++nodes_;
+    /* Stop a timed search when its deadline is reached. The clock is not read at each node since it is costly. */
+    if (timed_search_
+        && !(nodes_ & (TIME_CHECK_INTERVAL - 1))
+        && std::chrono::steady_clock::now() >= deadline_)
+        stop_search_->store(true);
+
+    /* Give up as soon as the search has been stopped. The caller ignores the returned value. */
+    if (stop_search_->load(std::memory_order_relaxed))
+        return 0;
+
+    /* The root is searched by the main thread and by the helpers, but only the main thread keeps its best move. */
+    const bool is_root = ply_ == 0;
+    /* Keep the window we have been called with to know which kind of bound we compute. */
+    const score_t original_alpha = alpha;
+    const score_t original_beta  = beta;
+    /* The content of the transposition table for this position and the best move it contains. */
+    TranspositionTable::Data tt_data;
+    uint_fast64_t tt_move = 0;
+
+    /* Check if the current node is a terminating node, i.e., if the game has been won by one of the players. */
+    score_t won_value;
+    if (isGameWon(won_value))
+        return won_value;
+
+    /* Is there a draw ? The root is the current position of the game: we need a move even if it is a repetition. */
+    if (!is_root && isRepetition()) {
+        /* Going back to a position already seen leads to a draw. */
+        return DRAW_VALUE;
+    } else { /* the game is not over. */
+        if (depth == 0) {
+            SEARCH_STATISTIC(++statistics_.leaf_nodes);
+            return use_quiescence_ ? quiescence(quiescence_depth_, alpha, beta, maximizingPlayer) : heuristic_value_;
+        }
 
-        positions_seen_.push_back(hash);
+        /* Use a transposition table to avoid redundant computation.
+         * The root is always searched since we need to know the best move. */
+        SEARCH_STATISTIC(++statistics_.tt_probes);
+        if (transposition_table_->probe(maximizing_player_ ? hash ^ BLACK_PERSPECTIVE_KEY : hash, &tt_data)) {
+            SEARCH_STATISTIC(++statistics_.tt_hits);
+            /* Return the stored value from the transposition table if it is enough to conclude. */
+            if (!is_root
+                && tt_data.depth >= depth
+                && (tt_data.bound == ExactBound
+                    || (tt_data.bound == LowerBound && tt_data.value >= beta)
+                    || (tt_data.bound == UpperBound && tt_data.value <= alpha))) {
+                SEARCH_STATISTIC(++statistics_.tt_cutoffs);
+                return tt_data.value;
+            }
+            /* Otherwise, the best move of the previous search of this position is searched first. */
+            tt_move = tt_data.move;
+        }
+    }
 
+    /* Retrieve the possibles moves. */
+    MoveList possible_moves;
+    availableMoves(possible_moves);
 
-        /* Checks for an illegal position. */
-        if (isPositionIllegal()) {
-            /* Undo the move and continue to the next move. */
-            positions_seen_.erase(std::remove(positions_seen_.begin(),
-                                              positions_seen_.end(), hash),
-                                  positions_seen_.end());
-            who_is_to_play_ ^= 1;
-            who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
-            updateHeuristicValueBack(move);
-            hash ^= zobrist_keys_moves_[who_is_to_play_][move];
-            continue;
-        }
+    /* Sort according to the value of the move in order to increase the number of cut-offs. */
+    if (use_neural_network_ordering_ && keepMove)
+        tensorflowSortMoves(possible_moves);
+    else if (use_killers_and_history_)
+        orderMovesWithKillersAndHistory(possible_moves);
+    if (tt_move)
+        possible_moves.prioritize(tt_move);
 
-        /* Recursively evaluate the next position with the negamax algorithm. */
-        buff = AlphaBetaEval(depth - 1,
-                             alpha,
-                             beta,
-                             !maximizingPlayer,
-                             false,
-                             hash);
+    /* Initialize the value we will return. */
+    score_t value = maximizingPlayer ? MINUS_INFTY - 1 : PLUS_INFTY + 1;
+    /* Create a buff used to keep the result of the recursive call. */
+    score_t buff;
+    /* The best move found so far. */
+    uint_fast64_t best_move = 0;
+    /* The number of children searched so far. */
+    int searched_moves = 0;
+
+    /* We do not consider all moves in order to have a speed-up.
+     * The moves are picked from the best to the worst one, only when they are needed. */
+    const int width = tree_width_ == -1 ? possible_moves.size()
+                                        : std::min(possible_moves.size(), tree_width_);
+    /* The reductions of the moves of this node. The moves of the root are never reduced. */
+    const auto &reductions = late_move_reductions_[std::min(depth, MAX_SEARCH_DEPTH)];
+    const bool reduce = use_late_move_reductions_ && !is_root;
+    for (int index = 0; index < width; ++index) {
+        const uint_fast64_t move = possible_moves.pickBest(index);
+        /* Late move reductions: a late move is expected to be worse than the best one. */
+        const int reduction = reduce ? reductions[std::min(searched_moves, LMR_TABLE_SIZE - 1)] : 0;
+        if (!searchMove(move,
+                        depth,
+                        alpha,
+                        beta,
+                        maximizingPlayer,
+                        reduction,
+                        use_pvs_ && searched_moves,
+                        hash,
+                        buff))
+            continue;
+        ++searched_moves;
 
-        /* Undo the move to backtrack to the current position. */
-        positions_seen_.erase(std::remove(positions_seen_.begin(),
-                                          positions_seen_.end(), hash),
-        positions_seen_.end());
-        who_is_to_play_ ^= 1;
-        who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
-        updateHeuristicValueBack(move);
-        hash ^= zobrist_keys_moves_[who_is_to_play_][move];
+        /* The value of a stopped search is meaningless: it must not be used nor stored. */
+        if (isSearchStopped())
+            return value;
 
         if (maximizingPlayer && buff > value) {
             /* We are maximizing the score and the current move's heuristic value
              * is greater than the current best value. */
             alpha = std::max(buff, alpha); /* Update alpha. */
             value = buff;                  /* Update the current best value. */
-            if (value >= beta)
+            best_move = move;
+            if (value >= beta) {
+                if (use_killers_and_history_)
+                    updateKillersAndHistory(move, depth);
+                SEARCH_STATISTIC(countCutoff(searched_moves));
                 break; /* Beta cutoff. */
-        } else if (buff < value) {
+            }
+        } else if (!maximizingPlayer && buff < value) {
             /* We are minimizing the score and the current move's heuristic value
              * is less than the current best value. */
             beta  = std::min(buff, beta); /* Update beta. */
             value = buff;                 /* Update the current best value. */
+            best_move = move;
             if (keepMove)
                 best_move_ = move;
-            if (value <= alpha)
+            if (value <= alpha) {
+                if (use_killers_and_history_)
+                    updateKillersAndHistory(move, depth);
+                SEARCH_STATISTIC(countCutoff(searched_moves));
                 break; /* Alpha cutoff. */
+            }
+        }
+
+        /* Young Brothers Wait: once the eldest move has been searched, the other ones are searched in parallel. */
+        if (split_tasks_ && searched_moves == 1 && depth >= YBWC_MIN_SPLIT_DEPTH && index + 1 < width) {
+            const uint_fast64_t eldest_move = best_move;
+            const bool cutoff = splitSearch(possible_moves,
+                                            index + 1,
+                                            width,
+                                            depth,
+                                            alpha,
+                                            beta,
+                                            maximizingPlayer,
+                                            reduce,
+                                            searched_moves,
+                                            hash,
+                                            value,
+                                            best_move);
+            if (isSearchStopped())
+                return value;
+            if (keepMove && best_move != eldest_move)
+                best_move_ = best_move;
+            if (cutoff) {
+                if (use_killers_and_history_)
+                    updateKillersAndHistory(best_move, depth);
+                SEARCH_STATISTIC(countCutoff(searched_moves + 1));
+            }
+            break;
         }
     }
 
-    /* Store the value in the transposition table when it makes sense. */
-    if (   (depth < fullDepth_ - 1)
-           && (value > alpha)
-           && (value < beta)) {
-        transposition_table_.emplace(hash, std::make_pair(value, depth));
+    /* Store the value in the transposition table with the kind of bound it is.
+     * A cut-off in a maximizing node gives a lower bound and a cut-off
+     * in a minimizing node gives an upper bound. */
+    Bound bound;
+    if (maximizingPlayer) {
+        bound = value >= original_beta  ? LowerBound
+              : value <= original_alpha ? UpperBound
+              : ExactBound;
+    } else {
+        bound = value <= original_alpha ? UpperBound
+              : value >= original_beta  ? LowerBound
+              : ExactBound;
     }
+    transposition_table_->store(maximizing_player_ ? hash ^ BLACK_PERSPECTIVE_KEY : hash,
+                                value,
+                                depth,
+                                bound,
+                                best_move);
 
     /* Return computed value. */
     return value;
 }
 
-double AlphaBeta::heuristicValue() {
-    /* Initialize the heuristic value to 0. */
-    double result = 0;
-    /* Loops over all possible positions. */
-    for (uint_fast64_t pawnPosition = un_64_; pawnPosition; pawnPosition <<= 1) {
-        /* Checks if there is a White pawn at the current position. */
-        if (pawnPosition & bit_boards_.White) {
-            if (maximizing_player_)
-                result -= player_to_lose_value_[63 - __builtin_ctzll(pawnPosition)];
-            else
-                result += player_to_win_value_[63 - __builtin_ctzll(pawnPosition)];
-        }
-        /* Checks if there is a Black pawn at the current position. */
-        else if (pawnPosition & bit_boards_.Black) {
-            if (maximizing_player_)
-                result += player_to_win_value_[__builtin_ctzll(pawnPosition)];
+bool AlphaBeta::searchMove(const uint_fast64_t &move,
+                           const int &depth,
+                           const score_t &alpha,
+                           const score_t &beta,
+                           const bool &maximizingPlayer,
+                           const int &reduction,
+                           const bool &null_window,
+                           uint_fast64_t hash,
+                           score_t &value) {
+    /* Update the heuristic value with the given move. */
+    updateHeuristicValue(move);
+    /* Update the hash for the current position. */
+    hash ^= zobristMoveKey(who_is_to_play_, move);
+
+    /* Apply the move to the current position. */
+    who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
+    /* Apply the move to the current position. */
+    who_is_to_play_ ^= 1;
+
+    /* Indicates that this position has been seen another time. */
+    pushPosition(hash);
+
+    /* Checks for an illegal position. */
+    if (isPositionIllegal()) {
+        SEARCH_STATISTIC(++statistics_.illegal_positions);
+        /* Undo the move: it is not searched. */
+        popPosition();
+        who_is_to_play_ ^= 1;
+        who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
+        updateHeuristicValueBack(move);
+        return false;
+    }
+
+    /* Recursively evaluate the next position with the negamax algorithm. */
+    ++ply_;
+    /* Late move reductions: a search at a reduced depth with a null window is enough to check that the move
+     * is not better. If it seems better, it is searched again at full depth. */
+    bool full_depth = true;
+    if (reduction) {
+        if (maximizingPlayer)
+            value = AlphaBetaEval(depth - 1 - reduction,
+                                  alpha,
+                                  alpha + 1,
+                                  !maximizingPlayer,
+                                  false,
+                                  hash);
+        else
+            value = AlphaBetaEval(depth - 1 - reduction,
+                                  beta - 1,
+                                  beta,
+                                  !maximizingPlayer,
+                                  false,
+                                  hash);
+        full_depth = maximizingPlayer ? value > alpha : value < beta;
+    }
+
+    /* Otherwise, the reduced search proved that the move is not better. */
+    if (full_depth) {
+        if (!null_window) {
+            value = AlphaBetaEval(depth - 1,
+                                  alpha,
+                                  beta,
+                                  !maximizingPlayer,
+                                  false,
+                                  hash);
+        } else {
+            /* Principal Variation Search: the first child is expected to be the best one.
+             * A null window is enough to prove that the other ones are not better. */
+            if (maximizingPlayer)
+                value = AlphaBetaEval(depth - 1,
+                                      alpha,
+                                      alpha + 1,
+                                      !maximizingPlayer,
+                                      false,
+                                      hash);
             else
-                result -= player_to_lose_value_[__builtin_ctzll(pawnPosition)];
+                value = AlphaBetaEval(depth - 1,
+                                      beta - 1,
+                                      beta,
+                                      !maximizingPlayer,
+                                      false,
+                                      hash);
+
+            /* The child is better: we need its exact value. */
+            if (value > alpha && value < beta)
+                value = AlphaBetaEval(depth - 1,
+                                      alpha,
+                                      beta,
+                                      !maximizingPlayer,
+                                      false,
+                                      hash);
         }
     }
+    --ply_;
+
+    /* Undo the move to backtrack to the current position. */
+    popPosition();
+    who_is_to_play_ ^= 1;
+    who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
+    updateHeuristicValueBack(move);
+    return true;
+}
+
+score_t AlphaBeta::heuristicValue() {
+    const uint_fast64_t maximizing_bit_board = maximizing_player_ ? bit_boards_.Black : bit_boards_.White;
+    const uint_fast64_t minimizing_bit_board = maximizing_player_ ? bit_boards_.White : bit_boards_.Black;
+    /* Each row of the board is a byte of the bit boards: its weights are summed in a single lookup. */
+    score_t result = 0;
+    for (int row = 0; row < 8; ++row) {
+        result += win_rows_[maximizing_player_][row][(maximizing_bit_board >> (row << 3)) & 0xFF]
+                  - lose_rows_[maximizing_player_ ^ 1][row][(minimizing_bit_board >> (row << 3)) & 0xFF];
+    }
     return result;
 }
 
+void AlphaBeta::computeRowWeights() {
+    for (Player player = 0; player < 2; ++player) {
+        /* The weights are seen from the perspective of the black player.
+         * Xoring an index with 63 is equivalent to 63 - index which gives the perspective of the white player. */
+        const int perspective = player ? 0 : 63;
+        for (int row = 0; row < 8; ++row) {
+            for (int byte = 0; byte < 256; ++byte) {
+                score_t win = 0, lose = 0;
+                for (int column = 0; column < 8; ++column) {
+                    if (byte & (1 << column)) {
+                        win  += player_to_win_score_[((row << 3) | column) ^ perspective];
+                        lose += player_to_lose_score_[((row << 3) | column) ^ perspective];
+                    }
+                }
+                win_rows_[player][row][byte]  = win;
+                lose_rows_[player][row][byte] = lose;
+            }
+        }
+    }
+}
+
 inline void AlphaBeta::updateHeuristicValue(const uint_fast64_t &move) {
     /* This function updates the heuristic value of the current game state
      * by adding or subtracting the value of the pawn moved in the last move. */
     if (who_is_to_play_) {
         if (maximizing_player_) {
-            heuristic_value_ += player_to_win_value_[__builtin_ctzll(move & ~bit_boards_.Black)]
-                                - player_to_win_value_[__builtin_ctzll(move & bit_boards_.Black)];
+            heuristic_value_ += player_to_win_score_[__builtin_ctzll(move & ~bit_boards_.Black)]
+                                - player_to_win_score_[__builtin_ctzll(move & bit_boards_.Black)];
         } else {
-            heuristic_value_ += player_to_lose_value_[__builtin_ctzll(move & bit_boards_.Black)]
-                               - player_to_lose_value_[__builtin_ctzll(move & ~bit_boards_.Black)];
+            heuristic_value_ += player_to_lose_score_[__builtin_ctzll(move & bit_boards_.Black)]
+                               - player_to_lose_score_[__builtin_ctzll(move & ~bit_boards_.Black)];
         }
     } else {
         if (maximizing_player_) {
-            heuristic_value_ += player_to_lose_value_[63 - __builtin_ctzll(move & bit_boards_.White)]
-                                - player_to_lose_value_[63 - __builtin_ctzll(move & ~bit_boards_.White)];
+            heuristic_value_ += player_to_lose_score_[63 - __builtin_ctzll(move & bit_boards_.White)]
+                                - player_to_lose_score_[63 - __builtin_ctzll(move & ~bit_boards_.White)];
         } else {
-            heuristic_value_ += player_to_win_value_[63 - __builtin_ctzll(move & ~bit_boards_.White)]
-                                - player_to_win_value_[63 - __builtin_ctzll(move & bit_boards_.White)];
+            heuristic_value_ += player_to_win_score_[63 - __builtin_ctzll(move & ~bit_boards_.White)]
+                                - player_to_win_score_[63 - __builtin_ctzll(move & bit_boards_.White)];
         }
     }
 }
@@ -489,19 +1187,19 @@ inline void AlphaBeta::updateHeuristicValueBack(const uint_fast64_t &move) {
      * by adding or subtracting the value of the pawn moved in the last move. */
     if (who_is_to_play_) {
         if (maximizing_player_) {
-            heuristic_value_ += player_to_win_value_[__builtin_ctzll(move & bit_boards_.Black)]
-                                - player_to_win_value_[__builtin_ctzll(move & ~bit_boards_.Black)];
+            heuristic_value_ += player_to_win_score_[__builtin_ctzll(move & bit_boards_.Black)]
+                                - player_to_win_score_[__builtin_ctzll(move & ~bit_boards_.Black)];
         } else {
-            heuristic_value_ += player_to_lose_value_[__builtin_ctzll(move & ~bit_boards_.Black)]
-                                - player_to_lose_value_[__builtin_ctzll(move & bit_boards_.Black)];
+            heuristic_value_ += player_to_lose_score_[__builtin_ctzll(move & ~bit_boards_.Black)]
+                                - player_to_lose_score_[__builtin_ctzll(move & bit_boards_.Black)];
         }
     } else {
         if (maximizing_player_) {
-            heuristic_value_ += player_to_lose_value_[63 - __builtin_ctzll(move & ~bit_boards_.White)]
-                                - player_to_lose_value_[63 - __builtin_ctzll(move & bit_boards_.White)];
+            heuristic_value_ += player_to_lose_score_[63 - __builtin_ctzll(move & ~bit_boards_.White)]
+                                - player_to_lose_score_[63 - __builtin_ctzll(move & bit_boards_.White)];
         } else {
-            heuristic_value_ += player_to_win_value_[63 - __builtin_ctzll(move & bit_boards_.White)]
-                                - player_to_win_value_[63 - __builtin_ctzll(move & ~bit_boards_.White)];
+            heuristic_value_ += player_to_win_score_[63 - __builtin_ctzll(move & bit_boards_.White)]
+                                - player_to_win_score_[63 - __builtin_ctzll(move & ~bit_boards_.White)];
         }
     }
 }
@@ -520,13 +1218,724 @@ std::vector<double> AlphaBeta::getPlayerToWinValue() {
 
 void AlphaBeta::setPlayerToLoseValue(const std::vector<double> &player_to_lose_value_) {
     this->player_to_lose_value_ = player_to_lose_value_;
+    player_to_lose_score_       = quantizeWeights(player_to_lose_value_);
+    computeRowWeights();
+    /* The values stored so far have been computed with the previous weights. */
+    transposition_table_->clear();
 }
 
 void AlphaBeta::setPlayerToWinValue(const std::vector<double> &player_to_win_value_) {
     this->player_to_win_value_ = player_to_win_value_;
+    player_to_win_score_       = quantizeWeights(player_to_win_value_);
+    computeRowWeights();
+    /* The values stored so far have been computed with the previous weights. */
+    transposition_table_->clear();
+}
+
+weights_t AlphaBeta::quantizeWeights(const std::vector<double> &weights) {
+    weights_t result = {};
+    for (std::size_t i = 0; i < std::min(weights.size(), result.size()); ++i)
+        result[i] = valueToScore(std::clamp(weights[i], -1.0, 1.0));
+    return result;
+}
+
+void AlphaBeta::setTranspositionTableSize(const int &size_mb) {
+    transposition_table_->resize(std::max(1, size_mb));
+}
+
+int AlphaBeta::getTranspositionTableSize() const {
+    return static_cast<int>(transposition_table_->getSizeMB());
+}
+
+void AlphaBeta::setNumberOfThreads(const int &number_of_threads) {
+    number_of_threads_ = std::max(1, number_of_threads);
+}
+
+int AlphaBeta::getNumberOfThreads() const {
+    return number_of_threads_;
+}
+
+void AlphaBeta::setYoungBrothersWait(const bool &use_ybwc) {
+    use_ybwc_ = use_ybwc;
+}
+
+bool AlphaBeta::getYoungBrothersWait() const {
+    return use_ybwc_;
+}
+
+void AlphaBeta::setKillersAndHistory(const bool &use_killers_and_history) {
+    use_killers_and_history_ = use_killers_and_history;
 }
 
-void AlphaBeta::loadOpenings() {
+bool AlphaBeta::getKillersAndHistory() const {
+    return use_killers_and_history_;
+}
+
+uint64_t AlphaBeta::getNodeCount() const {
+    return nodes_;
+}
+
+uint64_t AlphaBeta::getQuiescenceNodeCount() const {
+    return quiescence_nodes_;
+}
+
+SearchStatistics AlphaBeta::getSearchStatistics() const {
+    SearchStatistics statistics = statistics_;
+    statistics.nodes            = nodes_;
+    statistics.quiescence_nodes = quiescence_nodes_;
+    return statistics;
+}
+
+void AlphaBeta::recordIteration(const int &depth,
+                                const uint64_t &first_node,
+                                const std::chrono::steady_clock::time_point &start) {
+    statistics_.iterations.push_back({depth,
+                                      nodes_ - first_node,
+                                      std::chrono::duration<double, std::milli>(
+                                              std::chrono::steady_clock::now() - start).count()});
+}
+
+void AlphaBeta::setPrincipalVariationSearch(const bool &use_pvs) {
+    use_pvs_ = use_pvs;
+}
+
+bool AlphaBeta::getPrincipalVariationSearch() const {
+    return use_pvs_;
+}
+
+void AlphaBeta::setAspirationWindows(const bool &use_aspiration_windows) {
+    use_aspiration_windows_ = use_aspiration_windows;
+}
+
+bool AlphaBeta::getAspirationWindows() const {
+    return use_aspiration_windows_;
+}
+
+void AlphaBeta::setMTDF(const bool &use_mtdf) {
+    use_mtdf_ = use_mtdf;
+}
+
+bool AlphaBeta::getMTDF() const {
+    return use_mtdf_;
+}
+
+void AlphaBeta::setTreeWidth(const int &tree_width) {
+    tree_width_ = tree_width;
+}
+
+int AlphaBeta::getTreeWidth() const {
+    return tree_width_;
+}
+
+void AlphaBeta::setLateMoveReductions(const bool &use_late_move_reductions) {
+    use_late_move_reductions_ = use_late_move_reductions;
+}
+
+bool AlphaBeta::getLateMoveReductions() const {
+    return use_late_move_reductions_;
+}
+
+void AlphaBeta::setLateMoveReductionTable(const int &min_depth,
+                                          const int &full_depth_moves,
+                                          const double &base,
+                                          const double &divisor) {
+    late_move_reductions_ = computeLateMoveReductions(min_depth, full_depth_moves, base, divisor);
+}
+
+int AlphaBeta::getDistanceToWin() const {
+    return distance_to_win_;
+}
+
+void AlphaBeta::setWinSolver(const bool &use_win_solver) {
+    use_win_solver_ = use_win_solver;
+}
+
+bool AlphaBeta::getWinSolver() const {
+    return use_win_solver_;
+}
+
+void AlphaBeta::setWinSolverDepth(const int &win_solver_depth) {
+    win_solver_depth_ = win_solver_depth;
+}
+
+int AlphaBeta::getWinSolverDepth() const {
+    return win_solver_depth_;
+}
+
+void AlphaBeta::setQuiescence(const bool &use_quiescence) {
+    use_quiescence_ = use_quiescence;
+}
+
+bool AlphaBeta::getQuiescence() const {
+    return use_quiescence_;
+}
+
+void AlphaBeta::setQuiescenceDepth(const int &quiescence_depth) {
+    quiescence_depth_ = std::max(quiescence_depth, 0);
+}
+
+int AlphaBeta::getQuiescenceDepth() const {
+    return quiescence_depth_;
+}
+
+void AlphaBeta::setQuiescenceMargin(const double &quiescence_margin) {
+    quiescence_margin_ = valueToScore(quiescence_margin);
+}
+
+double AlphaBeta::getQuiescenceMargin() const {
+    return scoreToValue(quiescence_margin_);
+}
+
+int AlphaBeta::getLateMoveReduction(const int &depth, const int &index) const {
+    return late_move_reductions_[std::clamp(depth, 0, MAX_SEARCH_DEPTH)][std::clamp(index, 0, LMR_TABLE_SIZE - 1)];
+}
+
+lmr_table_t AlphaBeta::computeLateMoveReductions(const int &min_depth,
+                                                 const int &full_depth_moves,
+                                                 const double &base,
+                                                 const double &divisor) {
+    lmr_table_t result = {};
+    for (int depth = std::max(min_depth, 2); depth <= MAX_SEARCH_DEPTH; ++depth) {
+        for (int index = std::max(full_depth_moves, 1); index < LMR_TABLE_SIZE; ++index) {
+            const int reduction = static_cast<int>(base + std::log(depth) * std::log(index) / divisor);
+            /* The move is searched at least one ply deep. */
+            result[depth][index] = static_cast<uint8_t>(std::clamp(reduction, 0, depth - 2));
+        }
+    }
+    return result;
+}
+
+void AlphaBeta::setFloodFillMoveGeneration(const bool &use_flood_fill) {
+    use_flood_fill_ = use_flood_fill;
+}
+
+bool AlphaBeta::getFloodFillMoveGeneration() const {
+    return use_flood_fill_;
+}
+
+void AlphaBeta::setNeuralNetworkOrdering(const bool &use_neural_network_ordering) {
+    use_neural_network_ordering_ = use_neural_network_ordering;
+    if (use_neural_network_ordering_ && !model_)
+        model_ = sharedModel();
+}
+
+bool AlphaBeta::getNeuralNetworkOrdering() const {
+    return use_neural_network_ordering_;
+}
+
+inline bool AlphaBeta::hasWon(const Player &player) const {
+    const uint_fast64_t winning_positions = player ? winning_positions_black_ : winning_positions_white_;
+    return ((player ? bit_boards_.Black : bit_boards_.White) & winning_positions)
+           && ((bit_boards_.White | bit_boards_.Black) & winning_positions) == winning_positions;
+}
+
+inline bool AlphaBeta::isGameWon(score_t &value) const {
+    /* Only the player who has just played can have won the game. */
+    if (!hasWon(who_is_to_play_ ^ 1))
+        return false;
+    /* The value is the minimum score (MINUS_INFINITY) if the winner is the player we are playing for,
+     * and the maximum score (PLUS_INFINITY) otherwise. */
+    value = (who_is_to_play_ ^ 1) == maximizing_player_ ? MINUS_INFTY : PLUS_INFTY;
+    return true;
+}
+
+score_t AlphaBeta::quiescence(const int &depth, score_t alpha, score_t beta, const bool &maximizingPlayer) {
+    ++quiescence_nodes_;
+
+    score_t value;
+    if (isGameWon(value))
+        return value;
+
+    /* Stand pat: the player to play does not have to jump. */
+    value = heuristic_value_;
+    if (depth <= 0)
+        return value;
+    if (maximizingPlayer) {
+        if (value >= beta)
+            return value;
+        alpha = std::max(alpha, value);
+    } else {
+        if (value <= alpha)
+            return value;
+        beta = std::min(beta, value);
+    }
+
+    /* Only the jumps are generated. They are scored by their progress like in availableMoves. */
+    MoveList jumps;
+    if (use_flood_fill_)
+        availableJumpsFloodFill(jumps);
+    else
+        availableJumpsBFS(jumps);
+
+    score_t buff;
+    for (int index = 0; index < jumps.size(); ++index) {
+        const uint_fast64_t move = jumps.pickBest(index);
+        /* The next jumps make even less progress. */
+        if (jumps.score(index) <= quiescence_margin_)
+            break;
+
+        /* Apply the move to the current position. */
+        updateHeuristicValue(move);
+        who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
+        who_is_to_play_ ^= 1;
+
+        /* A forward jump never goes back to a position already seen: the repetitions are not checked. */
+        const bool illegal = isPositionIllegal();
+        if (!illegal)
+            buff = quiescence(depth - 1, alpha, beta, !maximizingPlayer);
+
+        /* Undo the move. */
+        who_is_to_play_ ^= 1;
+        who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
+        updateHeuristicValueBack(move);
+
+        if (illegal) {
+            SEARCH_STATISTIC(++statistics_.illegal_positions);
+            continue;
+        }
+        if (maximizingPlayer) {
+            value = std::max(value, buff);
+            alpha = std::max(alpha, value);
+        } else {
+            value = std::min(value, buff);
+            beta  = std::min(beta, value);
+        }
+        if (alpha >= beta)
+            break;
+    }
+    return value;
+}
+
+score_t AlphaBeta::aspirationSearch(const int &depth, const score_t &expected_value, const uint_fast64_t &hash) {
+    score_t delta = ASPIRATION_WINDOW;
+    score_t alpha = std::max(expected_value - delta, MINUS_INFTY);
+    score_t beta  = std::min(expected_value + delta, PLUS_INFTY);
+
+    while (true) {
+        const score_t value = AlphaBetaEval(depth,
+                                            alpha,
+                                            beta,
+                                            false,
+                                            true,
+                                            hash);
+        if (stop_search_->load(std::memory_order_relaxed))
+            return value;
+
+        /* Widen the window on the side the value fell. */
+        delta *= 2;
+        if (value <= alpha && alpha > MINUS_INFTY)
+            alpha = std::max(alpha - delta, MINUS_INFTY);
+        else if (value >= beta && beta < PLUS_INFTY)
+            beta  = std::min(beta + delta, PLUS_INFTY);
+        else
+            return value;
+    }
+}
+
+score_t AlphaBeta::mtdfSearch(const int &depth, const score_t &first_guess, const uint_fast64_t &hash) {
+    score_t value = std::clamp(first_guess, MINUS_INFTY, PLUS_INFTY);
+    score_t lower_bound = MINUS_INFTY;
+    score_t upper_bound = PLUS_INFTY;
+    /* The best move of the last search that found a move lower than its window. */
+    uint_fast64_t best_move = 0;
+
+    for (int pass = 0; pass < MTDF_MAX_PASSES && lower_bound < upper_bound; ++pass) {
+        /* Test if the value of the root is lower than beta. The scores are integers: the null window is [beta - 1, beta]. */
+        const score_t beta = value == lower_bound ? value + 1 : value;
+        value = AlphaBetaEval(depth,
+                              beta - 1,
+                              beta,
+                              false,
+                              true,
+                              hash);
+        if (stop_search_->load(std::memory_order_relaxed))
+            return value;
+
+        if (value < beta) {
+            /* The root is a minimizing node: best_move_ is the move that is lower than beta. */
+            upper_bound = value;
+            best_move   = best_move_;
+        } else {
+            lower_bound = value;
+        }
+    }
+
+    if (best_move)
+        best_move_ = best_move;
+    return value;
+}
+
+void AlphaBeta::orderMovesWithKillersAndHistory(MoveList &possible_moves) {
+    const uint_fast64_t currentBitBoard = who_is_to_play_ ? bit_boards_.Black : bit_boards_.White;
+
+    /* The history comes first. The static scores are lower than SCORE_SCALE in absolute value
+     * so they only break the ties. */
+    for (int i = 0; i < possible_moves.size(); ++i) {
+        possible_moves.score(i) += static_cast<double>(HISTORY_WEIGHT * SCORE_SCALE)
+                                   * history_[__builtin_ctzll(possible_moves[i] & currentBitBoard)]
+                                             [__builtin_ctzll(possible_moves[i] & ~currentBitBoard)];
+    }
+
+    /* The killer moves come before any other move, the most recent one first. */
+    if (ply_ > MAX_SEARCH_DEPTH)
+        return;
+    for (int k = NUMBER_OF_KILLER_MOVES - 1; k >= 0; --k) {
+        if (killer_moves_[ply_][k])
+            possible_moves.prioritize(killer_moves_[ply_][k]);
+    }
+}
+
+void AlphaBeta::updateKillersAndHistory(const uint_fast64_t &move, const int &depth) {
+    const uint_fast64_t currentBitBoard = who_is_to_play_ ? bit_boards_.Black : bit_boards_.White;
+    history_[__builtin_ctzll(move & currentBitBoard)][__builtin_ctzll(move & ~currentBitBoard)] += depth * depth;
+
+    if (ply_ > MAX_SEARCH_DEPTH || killer_moves_[ply_][0] == move)
+        return;
+    /* Shift the killer moves: the oldest one is forgotten. */
+    for (int k = NUMBER_OF_KILLER_MOVES - 1; k > 0; --k)
+        killer_moves_[ply_][k] = killer_moves_[ply_][k - 1];
+    killer_moves_[ply_][0] = move;
+}
+
+void AlphaBeta::newSearchOrdering() {
+    nodes_            = 0;
+    quiescence_nodes_ = 0;
+    ply_              = 0;
+    SEARCH_STATISTIC(statistics_ = SearchStatistics());
+    for (auto &killers : killer_moves_)
+        killers.fill(0);
+    /* Keep what has been learned but give more importance to the next search. */
+    for (auto &from : history_) {
+        for (int &value : from)
+            value >>= 1;
+    }
+}
+
+void AlphaBeta::copySearchState(AlphaBeta &engine) const {
+    /* Copy the current position and the parameters of the search to the engine. */
+    engine.bit_boards_                  = bit_boards_;
+    engine.who_is_to_play_              = who_is_to_play_;
+    engine.zobrist_hash_                = zobrist_hash_;
+    engine.positions_seen_              = positions_seen_;
+    engine.repetition_filter_           = repetition_filter_;
+    engine.player_to_win_value_         = player_to_win_value_;
+    engine.player_to_lose_value_        = player_to_lose_value_;
+    engine.player_to_win_score_         = player_to_win_score_;
+    engine.player_to_lose_score_        = player_to_lose_score_;
+    engine.win_rows_                    = win_rows_;
+    engine.lose_rows_                   = lose_rows_;
+    engine.maximizing_player_           = maximizing_player_;
+    engine.heuristic_value_             = heuristic_value_;
+    engine.use_killers_and_history_     = use_killers_and_history_;
+    engine.use_flood_fill_              = use_flood_fill_;
+    engine.use_neural_network_ordering_ = use_neural_network_ordering_;
+    engine.model_                       = model_;
+    engine.use_pvs_                     = use_pvs_;
+    engine.tree_width_                  = tree_width_;
+    engine.use_late_move_reductions_    = use_late_move_reductions_;
+    engine.late_move_reductions_        = late_move_reductions_;
+    engine.use_quiescence_              = use_quiescence_;
+    engine.quiescence_depth_            = quiescence_depth_;
+    engine.quiescence_margin_           = quiescence_margin_;
+}
+
+void AlphaBeta::startHelperThreads(const int &depth, const uint_fast64_t &hash) {
+    /* The engines of the helpers are created once and kept between searches.
+     * They are copies of this engine, hence they use the same Zobrist keys
+     * which is required to share the transposition table. */
+    while (static_cast<int>(helpers_.size()) < number_of_threads_ - 1)
+        helpers_.push_back(std::unique_ptr<AlphaBeta>(new AlphaBeta(*this, transposition_table_)));
+
+    /* The threads of the Young Brothers Wait search share their tasks. This engine uses the first queue. */
+    if (use_ybwc_ && number_of_threads_ > 1)
+        split_tasks_ = std::make_shared<WorkStealingQueues<SplitTask>>(number_of_threads_);
+    split_index_ = 0;
+
+    for (int i = 0; i < number_of_threads_ - 1; ++i) {
+        AlphaBeta &helper = *helpers_[i];
+
+        copySearchState(helper);
+        /* The helpers share the transposition table and the stop flag of this engine. */
+        helper.transposition_table_ = transposition_table_;
+        helper.stop_search_         = stop_search_;
+        helper.split_tasks_         = split_tasks_;
+        helper.split_index_         = i + 1;
+
+        if (split_tasks_)
+            helper_threads_.emplace_back(&AlphaBeta::ybwcWorker, &helper);
+        else
+            /* Half of the helpers start one ply deeper than the main search. */
+            helper_threads_.emplace_back(&AlphaBeta::helperSearch, &helper, depth + ((i + 1) & 1), hash);
+    }
+}
+
+void AlphaBeta::stopHelperThreads() {
+    if (helper_threads_.empty())
+        return;
+
+    stop_search_->store(true);
+    for (std::thread &helper_thread : helper_threads_)
+        helper_thread.join();
+    /* The helpers start each of their runs with no node. */
+    SEARCH_STATISTIC(for (std::size_t i = 0; i < helper_threads_.size(); ++i)
+                         statistics_.helper_nodes += helpers_[i]->nodes_);
+    helper_threads_.clear();
+    split_tasks_.reset();
+}
+
+void AlphaBeta::helperSearch(const int &depth, const uint_fast64_t &hash) {
+    newSearchOrdering();
+    /* Iterative deepening until the main search is over. */
+    for (int d = depth;
+         d <= MAX_SEARCH_DEPTH && !stop_search_->load(std::memory_order_relaxed);
+         ++d) {
+        fullDepth_ = d;
+        AlphaBetaEval(d,
+                      MINUS_INFTY,
+                      PLUS_INFTY,
+                      false,
+                      false,
+                      hash);
+    }
+}
+
+bool AlphaBeta::splitSearch(MoveList &possible_moves,
+                            const int &first_index,
+                            const int &width,
+                            const int &depth,
+                            score_t &alpha,
+                            score_t &beta,
+                            const bool &maximizingPlayer,
+                            const bool &reduce,
+                            const int &searched_moves,
+                            const uint_fast64_t &hash,
+                            score_t &value,
+                            uint_fast64_t &best_move) {
+    /* The split point is on the heap since it holds a copy of the position. */
+    auto split_point = std::make_unique<SplitPoint>();
+    split_point->bit_boards        = bit_boards_;
+    split_point->who_is_to_play    = who_is_to_play_;
+    split_point->heuristic_value   = heuristic_value_;
+    split_point->hash              = hash;
+    split_point->ply               = ply_;
+    split_point->positions_seen    = positions_seen_;
+    split_point->repetition_filter = repetition_filter_;
+    split_point->depth             = depth;
+    split_point->maximizing_player = maximizingPlayer;
+    split_point->reduce            = reduce;
+    split_point->parent            = current_split_point_;
+    split_point->alpha             = alpha;
+    split_point->beta              = beta;
+    split_point->value             = value;
+    split_point->best_move         = best_move;
+    split_point->pending           = width - first_index;
+
+    /* The moves are pushed from the worst to the best one: this engine pops the best ones first
+     * and the other threads steal the worst ones. */
+    for (int index = first_index; index < width; ++index)
+        possible_moves.pickBest(index);
+    for (int index = width - 1; index >= first_index; --index)
+        split_tasks_->push(split_index_,
+                           {split_point.get(), possible_moves[index], searched_moves + index - first_index});
+
+    /* Search the moves until they have all been searched, by this engine or by the other threads.
+     * When there is nothing left to search, this engine helps the other threads with their own split points. */
+    const SplitPoint *waiting_split_point = waiting_split_point_;
+    waiting_split_point_  = split_point.get();
+    position_split_point_ = split_point.get();
+    SplitTask task;
+    while (split_point->pending.load(std::memory_order_acquire)) {
+        if (split_tasks_->pop(split_index_, task) || split_tasks_->steal(split_index_, task)) {
+            searchSplitTask(task);
+        } else {
+            /* A timed search is stopped on time even if this engine does not visit any node. */
+            if (timed_search_ && std::chrono::steady_clock::now() >= deadline_)
+                stop_search_->store(true);
+            std::this_thread::yield();
+        }
+    }
+    /* The tasks of the other split points have changed the position. */
+    if (position_split_point_ != split_point.get())
+        loadSplitPoint(*split_point);
+    waiting_split_point_  = waiting_split_point;
+    position_split_point_ = nullptr;
+
+    alpha     = split_point->alpha;
+    beta      = split_point->beta;
+    value     = split_point->value;
+    best_move = split_point->best_move;
+    return split_point->cutoff.load(std::memory_order_relaxed);
+}
+
+void AlphaBeta::searchSplitTask(const SplitTask &task) {
+    SplitPoint &split_point = *task.split_point;
+    /* A cut-off may have made the task useless since it was created. */
+    if (!stop_search_->load(std::memory_order_relaxed) && !split_point.isCancelled()) {
+        if (position_split_point_ != &split_point)
+            loadSplitPoint(split_point);
+        /* The window has shrunk with the moves already searched. */
+        score_t alpha, beta;
+        {
+            std::lock_guard<std::mutex> lock(split_point.mutex);
+            alpha = split_point.alpha;
+            beta  = split_point.beta;
+        }
+
+        const SplitPoint *current_split_point = current_split_point_;
+        current_split_point_ = &split_point;
+        const int reduction = split_point.reduce
+                              ? late_move_reductions_[std::min(split_point.depth, MAX_SEARCH_DEPTH)]
+                                                     [std::min(task.index, LMR_TABLE_SIZE - 1)]
+                              : 0;
+        score_t value;
+        const bool legal = searchMove(task.move,
+                                      split_point.depth,
+                                      alpha,
+                                      beta,
+                                      split_point.maximizing_player,
+                                      reduction,
+                                      use_pvs_,
+                                      split_point.hash,
+                                      value);
+        const bool stopped = isSearchStopped();
+        current_split_point_ = current_split_point;
+        /* The move has been undone. Only the split point this engine is waiting for outlives the task. */
+        position_split_point_ = &split_point == waiting_split_point_ ? &split_point : nullptr;
+
+        if (legal && !stopped) {
+            std::lock_guard<std::mutex> lock(split_point.mutex);
+            if (split_point.maximizing_player ? value > split_point.value : value < split_point.value) {
+                split_point.value     = value;
+                split_point.best_move = task.move;
+                if (split_point.maximizing_player) {
+                    split_point.alpha = std::max(split_point.alpha, value);
+                    if (value >= split_point.beta)
+                        split_point.cutoff.store(true, std::memory_order_relaxed);
+                } else {
+                    split_point.beta = std::min(split_point.beta, value);
+                    if (value <= split_point.alpha)
+                        split_point.cutoff.store(true, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+    split_point.pending.fetch_sub(1, std::memory_order_release);
+}
+
+void AlphaBeta::loadSplitPoint(const SplitPoint &split_point) {
+    bit_boards_           = split_point.bit_boards;
+    who_is_to_play_       = split_point.who_is_to_play;
+    heuristic_value_      = split_point.heuristic_value;
+    ply_                  = split_point.ply;
+    positions_seen_       = split_point.positions_seen;
+    repetition_filter_    = split_point.repetition_filter;
+    position_split_point_ = &split_point;
+}
+
+void AlphaBeta::ybwcWorker() {
+    newSearchOrdering();
+    SplitTask task;
+    /* Outside of the tasks, the queue of this engine is empty: the tasks are stolen from the other threads. */
+    while (!stop_search_->load(std::memory_order_relaxed)) {
+        if (split_tasks_->steal(split_index_, task))
+            searchSplitTask(task);
+        else
+            std::this_thread::yield();
+    }
+}
+
+bool AlphaBeta::startPondering() {
+    stopPondering();
+    if (stateOfGame() != NotFinished)
+        return false;
+
+    /* The reply expected by the last search is the best move stored for the current position.
+     * The values of this search were computed for the player who has just played. */
+    computeAndSetZobristHash();
+    TranspositionTable::Data tt_data;
+    if (!transposition_table_->probe(who_is_to_play_ ? zobrist_hash_ : zobrist_hash_ ^ BLACK_PERSPECTIVE_KEY, &tt_data)
+        || !tt_data.move)
+        return false;
+    /* The move may come from another position with the same key. */
+    MoveList possible_moves;
+    availableMoves(possible_moves);
+    if (std::find(possible_moves.begin(), possible_moves.end(), tt_data.move) == possible_moves.end())
+        return false;
+
+    /* Like the helpers, the engine is created once and kept. */
+    if (!ponder_engine_)
+        ponder_engine_ = std::unique_ptr<AlphaBeta>(new AlphaBeta(*this, transposition_table_));
+    copySearchState(*ponder_engine_);
+    /* The engine shares the transposition table but it is stopped with its own flag. */
+    ponder_engine_->transposition_table_ = transposition_table_;
+    ponder_engine_->stop_search_->store(false);
+    ponder_engine_->ponder_depth_ = 0;
+    ponder_engine_->moveWithoutVerification(tt_data.move);
+    if (ponder_engine_->isPositionIllegal())
+        return false;
+
+    ponder_reply_  = tt_data.move;
+    ponder_thread_ = std::thread(&AlphaBeta::ponderSearch, ponder_engine_.get());
+    return true;
+}
+
+bool AlphaBeta::stopPondering() {
+    if (!ponder_thread_.joinable())
+        return false;
+
+    ponder_engine_->stop_search_->store(true);
+    ponder_thread_.join();
+    ponder_reply_ = 0;
+    return isPonderHit();
+}
+
+bool AlphaBeta::isPondering() const {
+    return ponder_thread_.joinable();
+}
+
+uint_fast64_t AlphaBeta::getPonderReply() const {
+    return ponder_reply_;
+}
+
+bool AlphaBeta::isPonderHit() const {
+    return ponder_engine_
+           && ponder_engine_->ponder_depth_
+           && ponder_engine_->who_is_to_play_ == who_is_to_play_
+           && bitBoardsEqual{}(ponder_engine_->bit_boards_, bit_boards_);
+}
+
+void AlphaBeta::ponderSearch() {
+    maximizing_player_ = who_is_to_play_;
+    heuristic_value_   = heuristicValue();
+    computeAndSetZobristHash();
+    const uint_fast64_t hash = zobrist_hash_;
+
+    /* The transposition table is not aged: this search is the beginning of the next one. */
+    newSearchOrdering();
+    /* Iterative deepening until the pondering is stopped. */
+    for (int depth = 1; depth <= MAX_SEARCH_DEPTH; ++depth) {
+        fullDepth_ = depth;
+        best_move_ = 0;
+        const score_t val = AlphaBetaEval(depth,
+                                          MINUS_INFTY,
+                                          PLUS_INFTY,
+                                          false,
+                                          true,
+                                          hash);
+        if (stop_search_->load())
+            break;
+        ponder_depth_ = depth;
+        ponder_move_  = best_move_;
+        ponder_value_ = val;
+
+        /* A win has been found: a deeper search would only find a longer one. */
+        if (val == MINUS_INFTY)
+            break;
+    }
+}
+
+std::shared_ptr<openings_t> AlphaBeta::loadOpenings() {
+    std::shared_ptr<openings_t> openings = std::make_shared<openings_t>();
     std::array<std::string, 2> files =
             {"./raw_data/openings_white.dat",
              "./raw_data/openings_black.dat"};
@@ -543,13 +1952,26 @@ void AlphaBeta::loadOpenings() {
             std::istringstream ss(line);
             ss >> std::hex >> bb.White >> std::hex >> bb.Black >> std::hex >> move;
 
-            /* Store the opening move in the 'opening_' map, indexed by the bitboards. */
-            opening_[i][bb] = move;
+            /* Store the opening move in the map, indexed by the bitboards. */
+            (*openings)[i][bb] = move;
         }
 
         /* Close the file */
         inFile.close();
     }
+    return openings;
+}
+
+std::shared_ptr<const openings_t> AlphaBeta::sharedOpenings() {
+    /* The initialization of a static local variable is thread-safe. */
+    static const std::shared_ptr<const openings_t> openings = loadOpenings();
+    return openings;
+}
+
+std::shared_ptr<cppflow::model> AlphaBeta::sharedModel() {
+    /* The initialization of a static local variable is thread-safe. */
+    static const std::shared_ptr<cppflow::model> model = std::make_shared<cppflow::model>("model");
+    return model;
 }
 
 ListOfPositionType AlphaBeta::retrieveMoves(const uint_fast64_t &move) {
@@ -563,17 +1985,15 @@ ListOfPositionType AlphaBeta::retrieveMoves(const uint_fast64_t &move) {
 
     /* This part of the code handles the case of not jump moves. */
 
-    /* Iterates over each of the direct neighbors of the pawn
+    /* Checks if the arrival position is a direct neighbor of the pawn
      * using the direct_neighbours_ data structure. */
-    for (const auto &neig : direct_neighbours_[__builtin_ctzll(currentBitBoard & move)]) {
-        if (neig & move) {
-            /* If the neighbor position is not occupied by any pawn (White or Black),
-             * then the move is valid and returned. */
-            return {{uint64_to_pair_[__builtin_ctzll(currentBitBoard & move)].first,
-                     uint64_to_pair_[__builtin_ctzll(currentBitBoard & move)].second},
-                    {uint64_to_pair_[__builtin_ctzll(neig)].first,
-                     uint64_to_pair_[__builtin_ctzll(neig)].second}};
-        }
+    const uint_fast64_t neig = direct_neighbours_[__builtin_ctzll(currentBitBoard & move)] & move;
+    if (neig) {
+        /* The move is not a jump and it is returned. */
+        return {{uint64_to_pair_[__builtin_ctzll(currentBitBoard & move)].first,
+                 uint64_to_pair_[__builtin_ctzll(currentBitBoard & move)].second},
+                {uint64_to_pair_[__builtin_ctzll(neig)].first,
+                 uint64_to_pair_[__builtin_ctzll(neig)].second}};
     }
 
 
@@ -627,14 +2047,16 @@ ListOfPositionType AlphaBeta::retrieveMoves(const uint_fast64_t &move) {
 
             /* Loop over all possible jumps for the current node. */
             for (const auto &possibleJumps : k_neighbours_[__builtin_ctzll(v)]) {
-                for (const auto &possibleJump : possibleJumps) {
+                for (const JumpEntry &possibleJump : possibleJumps) {
+                    /* There is no farther jump in this direction. */
+                    if (!possibleJump.pivot)
+                        break;
 
                     /* Check if there is a pawn to jump over and if the jump is valid. */
-                    if (((bit_boards_.White | bit_boards_.Black) & possibleJump.first.first)
-                        && ! ((bit_boards_.White   | bit_boards_.Black        )
-                            & (possibleJump.second | possibleJump.first.second))) {
+                    if (((bit_boards_.White | bit_boards_.Black) & possibleJump.pivot)
+                        && !((bit_boards_.White | bit_boards_.Black) & possibleJump.line)) {
                         /* Store the possible elementary moves for the current node. */
-                        temp_elementary_move.push_back(possibleJump.first.second);
+                        temp_elementary_move.push_back(possibleJump.landing);
                         break;
                     }
                 }
@@ -682,7 +2104,7 @@ ListOfPositionType AlphaBeta::retrieveMoves(const uint_fast64_t &move) {
     return {};
 }
 
-void AlphaBeta::tensorflowSortMoves(std::set<uint_fast64_t, decltype(comp_move_)> &possible_moves) {
+void AlphaBeta::tensorflowSortMoves(MoveList &possible_moves) {
     /* We create a tensor for tensorFlow to evaluate all moves at once. */
     std::vector <uint8_t> bb_temp;
     std::vector<float> data_;
@@ -706,16 +2128,63 @@ void AlphaBeta::tensorflowSortMoves(std::set<uint_fast64_t, decltype(comp_move_)
     cppflow::tensor tensor_data_ = cppflow::tensor(data_, {static_cast<int>(possible_moves.size()), 128});
 
     /* Run the tensor through the TensorFlow model and get the predicted value of each move. */
-    std::vector <cppflow::tensor> output = (*model)({{"serving_default_dense_input:0", tensor_data_}},
-                                                    {"StatefulPartitionedCall:0"});
+    std::vector <cppflow::tensor> output = (*model_)({{"serving_default_dense_input:0", tensor_data_}},
+                                                     {"StatefulPartitionedCall:0"});
 
-    /* Map each possible move to its predicted value. */
-    result_tensorFlow_.clear();
+    /* Score each possible move with its predicted value.
+     * Black looks for the highest values and White for the lowest ones. */
     auto output_data_ = output[0].get_data<double>();
+    for (int d = 0; d < possible_moves.size(); ++d)
+        possible_moves.score(d) = who_is_to_play_ ? output_data_[d] : -output_data_[d];
+}
 
-    int d = 0;
-    for (const auto &move : possible_moves)
-        result_tensorFlow_[move] = output_data_[d++];
+uint64_t AlphaBeta::perft(const int &depth) {
+    if (depth == 0)
+        return 1;
+
+    MoveList possible_moves;
+    availableMoves(possible_moves);
+
+    uint64_t result = 0;
+    for (const uint_fast64_t &move : possible_moves) {
+        /* Apply the move. The hash and the history are not needed. */
+        who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
+        who_is_to_play_ ^= 1;
+
+        if (!isPositionIllegal())
+            result += perft(depth - 1);
+
+        /* Undo the move. */
+        who_is_to_play_ ^= 1;
+        who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
+    }
+    return result;
+}
+
+std::vector<std::pair<uint_fast64_t, uint64_t>> AlphaBeta::perftDivide(const int &depth) {
+    std::vector<std::pair<uint_fast64_t, uint64_t>> result;
+    if (depth == 0)
+        return result;
+
+    MoveList possible_moves;
+    availableMoves(possible_moves);
+
+    for (const uint_fast64_t &move : possible_moves) {
+        /* Apply the move. */
+        who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
+        who_is_to_play_ ^= 1;
+
+        if (!isPositionIllegal())
+            result.emplace_back(move, perft(depth - 1));
+
+        /* Undo the move. */
+        who_is_to_play_ ^= 1;
+        who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
+    }
+
+    /* Sort the moves to make the output easy to compare. */
+    std::sort(result.begin(), result.end());
+    return result;
 }
 
 std::vector<uint8_t> AlphaBeta::bitBoardsAsVector(const bitBoards_t &bb) {
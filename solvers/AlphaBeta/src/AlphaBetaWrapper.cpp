@@ -110,6 +110,15 @@ struct ListOfPositionType_to_list {
     }
 };
 
+struct Analysis_to_list {
+    static PyObject* convert(std::vector<std::pair<ListOfPositionType, double>> const& analysis) {
+        boost::python::list *result = new boost::python::list;
+        for (const auto &scored_move : analysis)
+            result->append(boost::python::make_tuple(scored_move.first, scored_move.second));
+        return boost::python::incref(result->ptr());
+    }
+};
+
 struct Result_to_int {
     static PyObject* convert(Result const& value) {
         boost::python::long_ *result = new boost::python::long_;
@@ -162,6 +171,8 @@ struct fromPythonToColor {
 BOOST_PYTHON_MODULE(AlphaBeta) {
     boost::python::to_python_converter<ListOfPositionType,
                                             ListOfPositionType_to_list>();
+    boost::python::to_python_converter<std::vector<std::pair<ListOfPositionType, double>>,
+                                            Analysis_to_list>();
     fromPythonToColor();
 
     iterable_converter()
@@ -179,12 +190,46 @@ BOOST_PYTHON_MODULE(AlphaBeta) {
         .value("WhiteWon", WhiteWon)
         .value("BlackWon", BlackWon);
 
+    boost::python::class_<IterationStatistics>("IterationStatistics")
+        .def_readonly("depth", &IterationStatistics::depth)
+        .def_readonly("nodes", &IterationStatistics::nodes)
+        .def_readonly("time_ms", &IterationStatistics::time_ms);
+
+    boost::python::class_<std::vector<IterationStatistics>>("ListOfIterationStatistics")
+        .def(boost::python::vector_indexing_suite<std::vector<IterationStatistics>>());
+
+    boost::python::class_<SearchStatistics>("SearchStatistics")
+        .def_readonly("nodes", &SearchStatistics::nodes)
+        .def_readonly("quiescence_nodes", &SearchStatistics::quiescence_nodes)
+        .def_readonly("helper_nodes", &SearchStatistics::helper_nodes)
+        .def_readonly("leaf_nodes", &SearchStatistics::leaf_nodes)
+        .def_readonly("illegal_positions", &SearchStatistics::illegal_positions)
+        .def_readonly("tt_probes", &SearchStatistics::tt_probes)
+        .def_readonly("tt_hits", &SearchStatistics::tt_hits)
+        .def_readonly("tt_cutoffs", &SearchStatistics::tt_cutoffs)
+        .def_readonly("cutoffs", &SearchStatistics::cutoffs)
+        .def_readonly("first_move_cutoffs", &SearchStatistics::first_move_cutoffs)
+        .def_readonly("iterations", &SearchStatistics::iterations)
+        .def("firstMoveCutoffRate", &SearchStatistics::firstMoveCutoffRate)
+        .def("effectiveBranchingFactor", &SearchStatistics::effectiveBranchingFactor);
+
     boost::python::class_<AlphaBeta>("Solver", boost::python::init<>())
         .def("getMove", &AlphaBeta::getMove)
+        .def("getMoveWithin", &AlphaBeta::getMoveWithin)
+        .def("analyse", &AlphaBeta::analyse)
         .def("state_of_game", &AlphaBeta::stateOfGame)
         .def("print_grid_", &AlphaBeta::printGrid)
         .def("move", &AlphaBeta::move)
         .def("isHuman", &AlphaBeta::isHuman)
+        .def("setNumberOfThreads", &AlphaBeta::setNumberOfThreads)
+        .def("getNumberOfThreads", &AlphaBeta::getNumberOfThreads)
+        .def("setYoungBrothersWait", &AlphaBeta::setYoungBrothersWait)
+        .def("getYoungBrothersWait", &AlphaBeta::getYoungBrothersWait)
+        .def("setTranspositionTableSize", &AlphaBeta::setTranspositionTableSize)
+        .def("getTranspositionTableSize", &AlphaBeta::getTranspositionTableSize)
+        .def("startPondering", &AlphaBeta::startPondering)
+        .def("stopPondering", &AlphaBeta::stopPondering)
+        .def("getSearchStatistics", &AlphaBeta::getSearchStatistics)
         .def(boost::python::init<>())
         .def(boost::python::init<const std::vector<double>&,
                                  const std::vector<double>&>());
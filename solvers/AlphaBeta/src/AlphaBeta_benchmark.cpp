@@ -39,5 +39,179 @@ static void BM_GetMoveD3(benchmark::State &state) {
 // Register the function as a benchmark
 BENCHMARK(BM_GetMoveD3)->Arg(0)->Arg(1)->Arg(2)->Arg(5)->Arg(10)->Arg(15)->Arg(20)->Unit(benchmark::kMillisecond);
 
+static void BM_GetMoveD5LazySMP(benchmark::State &state) {
+    // Perform setup here
+    AlphaBeta ab;
+    for (int i = 0; i < state.range(0); ++i)
+        ab.move(i & 0x1, ab.getMove(3, -1000000, 1000000));
+    ab.setNumberOfThreads(static_cast<int>(state.range(1)));
+
+    for (auto _ : state) {
+        // This code gets timed
+        ab.getMove64(5);
+    }
+}
+
+// Time to depth 5 depending on the number of threads
+BENCHMARK(BM_GetMoveD5LazySMP)
+    ->ArgsProduct({{10, 20}, {1, 2, 4, 8, 16}})
+    ->ArgNames({"moves", "threads"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_GetMoveD5YBWC(benchmark::State &state) {
+    // Perform setup here
+    AlphaBeta ab;
+    for (int i = 0; i < state.range(0); ++i)
+        ab.move(i & 0x1, ab.getMove(3, -1000000, 1000000));
+    ab.setNumberOfThreads(static_cast<int>(state.range(1)));
+    ab.setYoungBrothersWait(true);
+
+    for (auto _ : state) {
+        // This code gets timed
+        ab.getMove64(5);
+    }
+}
+
+// Time to depth 5 depending on the number of threads sharing the nodes with the Young Brothers Wait search
+BENCHMARK(BM_GetMoveD5YBWC)
+    ->ArgsProduct({{10, 20}, {1, 2, 4, 8, 16}})
+    ->ArgNames({"moves", "threads"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_GetMoveD5Ordering(benchmark::State &state) {
+    // Perform setup here
+    AlphaBeta ab;
+    for (int i = 0; i < state.range(0); ++i)
+        ab.move(i & 0x1, ab.getMove(3, -1000000, 1000000));
+    ab.setKillersAndHistory(state.range(1));
+
+    uint64_t nodes = 0;
+    for (auto _ : state) {
+        // Each search starts with an empty transposition table
+        state.PauseTiming();
+        ab.setTranspositionTableSize(ab.getTranspositionTableSize());
+        state.ResumeTiming();
+
+        // This code gets timed
+        ab.getMove64(5);
+        nodes += ab.getNodeCount();
+    }
+    state.counters["nodes"] = benchmark::Counter(static_cast<double>(nodes), benchmark::Counter::kAvgIterations);
+}
+
+// Nodes searched to depth 5 with and without the killer moves and the history heuristic
+BENCHMARK(BM_GetMoveD5Ordering)
+    ->ArgsProduct({{0, 10, 20}, {0, 1}})
+    ->ArgNames({"moves", "killers_history"})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_GetMoveD5Windows(benchmark::State &state) {
+    // Perform setup here
+    AlphaBeta ab;
+    for (int i = 0; i < state.range(0); ++i)
+        ab.move(i & 0x1, ab.getMove(3, -1000000, 1000000));
+    ab.setPrincipalVariationSearch(state.range(1));
+    ab.setAspirationWindows(state.range(2));
+
+    uint64_t nodes = 0;
+    for (auto _ : state) {
+        // Each search starts with an empty transposition table
+        state.PauseTiming();
+        ab.setTranspositionTableSize(ab.getTranspositionTableSize());
+        state.ResumeTiming();
+
+        // This code gets timed
+        ab.getMove64(5);
+        nodes += ab.getNodeCount();
+    }
+    state.counters["nodes"] = benchmark::Counter(static_cast<double>(nodes), benchmark::Counter::kAvgIterations);
+}
+
+// Nodes searched to depth 5 with and without PVS and aspiration windows
+BENCHMARK(BM_GetMoveD5Windows)
+    ->ArgsProduct({{0, 10, 20}, {0, 1}, {0, 1}})
+    ->ArgNames({"moves", "pvs", "aspiration"})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_GetMoveD5Reductions(benchmark::State &state) {
+    // Perform setup here
+    AlphaBeta ab;
+    for (int i = 0; i < state.range(0); ++i)
+        ab.move(i & 0x1, ab.getMove(3, -1000000, 1000000));
+    ab.setTreeWidth(static_cast<int>(state.range(1)));
+    ab.setLateMoveReductions(state.range(2));
+
+    uint64_t nodes = 0;
+    for (auto _ : state) {
+        // Each search starts with an empty transposition table
+        state.PauseTiming();
+        ab.setTranspositionTableSize(ab.getTranspositionTableSize());
+        state.ResumeTiming();
+
+        // This code gets timed
+        ab.getMove64(5);
+        nodes += ab.getNodeCount();
+    }
+    state.counters["nodes"] = benchmark::Counter(static_cast<double>(nodes), benchmark::Counter::kAvgIterations);
+}
+
+// Nodes searched to depth 5 with a fixed tree width and with the late move reductions
+BENCHMARK(BM_GetMoveD5Reductions)
+    ->ArgsProduct({{0, 10, 20}, {10, -1}, {0, 1}})
+    ->ArgNames({"moves", "width", "lmr"})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_GetMoveD5Drivers(benchmark::State &state) {
+    // Perform setup here
+    AlphaBeta ab;
+    for (int i = 0; i < state.range(0); ++i)
+        ab.move(i & 0x1, ab.getMove(3, -1000000, 1000000));
+    // The search of the previous move gives MTD(f) its first guess
+    ab.getMove64(3);
+    ab.setMTDF(state.range(1));
+
+    uint64_t nodes = 0;
+    for (auto _ : state) {
+        // Each search starts with an empty transposition table and the same first guess
+        state.PauseTiming();
+        AlphaBeta engine(ab);
+        state.ResumeTiming();
+
+        // This code gets timed
+        engine.getMove64(5);
+        nodes += engine.getNodeCount();
+    }
+    state.counters["nodes"] = benchmark::Counter(static_cast<double>(nodes), benchmark::Counter::kAvgIterations);
+}
+
+// Nodes searched to depth 5 by a single alpha-beta search and by MTD(f)
+BENCHMARK(BM_GetMoveD5Drivers)
+    ->ArgsProduct({{0, 10, 20}, {0, 1}})
+    ->ArgNames({"moves", "mtdf"})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_AvailableMoves(benchmark::State &state) {
+    // Perform setup here
+    AlphaBeta ab;
+    for (int i = 0; i < state.range(0); ++i)
+        ab.move(i & 0x1, ab.getMove(3, -1000000, 1000000));
+    ab.setFloodFillMoveGeneration(state.range(1));
+
+    MoveList moves;
+    for (auto _ : state) {
+        // This code gets timed
+        moves.clear();
+        ab.availableMoves(moves);
+        benchmark::DoNotOptimize(moves);
+    }
+}
+
+// Time to generate the moves with the BFS and the flood fill generators of the jumps
+BENCHMARK(BM_AvailableMoves)
+    ->ArgsProduct({{0, 10, 20}, {0, 1}})
+    ->ArgNames({"moves", "flood_fill"});
+
 // Run the benchmark
 BENCHMARK_MAIN();
@@ -0,0 +1,844 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * \file AlphaBeta_unittest.cpp
+ * \brief Unit test of the Alpha-Beta solver
+ */
+
+/* AlphaBeta.hpp */
+#include "AlphaBeta.hpp"
+
+/* C libraries */
+#include <gtest/gtest.h>
+
+/* C++ libraries */
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <array>
+
+/* Other */
+#include <Types.hpp>
+
+/*! \cond DO_NOT_DOCUMENT */
+
+/* only public interface should be tested.
+ * Each test suit correspond to a method. */
+
+/* Plays the first moves of a game used by several tests. */
+static void playMiddleGame(AlphaBeta *ab, const int &number_of_moves) {
+    const std::vector<std::pair<Player, ListOfPositionType>> moves = {
+        {0, {{0, 2}, {0, 4}}},
+        {1, {{5, 7}, {5, 5}}},
+        {0, {{1, 1}, {1, 3}}},
+        {1, {{6, 5}, {4, 5}}},
+        {0, {{0, 1}, {4, 1}}},
+        {1, {{6, 6}, {4, 6}, {4, 4}}},
+        {0, {{2, 0}, {4, 0}, {4, 2}}},
+        {1, {{7, 6}, {3, 6}, {5, 4}, {3, 4}}},
+        {0, {{1, 0}, {5, 0}, {3, 2}, {5, 2}}},
+        {1, {{5, 5}, {3, 5}, {3, 3}, {5, 1}, {3, 1}, {1, 1}}}};
+    for (int i = 0; i < number_of_moves; ++i)
+        ASSERT_TRUE(ab->move(moves[i].first, moves[i].second));
+}
+
+/*
+ * Tests for perft
+ */
+
+TEST(Perft, DepthZeroCountsTheCurrentPosition) {
+    /* Arrange */
+    AlphaBeta ab;
+
+    /* Act */
+    /* Assert */
+    EXPECT_EQ(ab.perft(0), 1);
+}
+
+TEST(Perft, InitialPosition) {
+    /* Arrange */
+    AlphaBeta ab;
+
+    /* Act */
+    /* Assert */
+    EXPECT_EQ(ab.perft(1), 14);
+    EXPECT_EQ(ab.perft(2), 196);
+    EXPECT_EQ(ab.perft(3), 4340);
+}
+
+TEST(Perft, MiddleGameWhiteToPlay) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 6);
+
+    /* Act */
+    /* Assert */
+    EXPECT_EQ(ab.perft(1), 37);
+    EXPECT_EQ(ab.perft(2), 1823);
+    EXPECT_EQ(ab.perft(3), 74690);
+}
+
+TEST(Perft, MiddleGameBlackToPlay) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 9);
+
+    /* Act */
+    /* Assert */
+    EXPECT_EQ(ab.perft(1), 87);
+    EXPECT_EQ(ab.perft(2), 6107);
+    EXPECT_EQ(ab.perft(3), 475976);
+}
+
+TEST(Perft, DoesNotChangeThePosition) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 5);
+    const uint_fast64_t white = ab.getBitBoardWhite();
+    const uint_fast64_t black = ab.getBitBoardBlack();
+
+    /* Act */
+    ab.perft(3);
+
+    /* Assert */
+    EXPECT_EQ(ab.getBitBoardWhite(), white);
+    EXPECT_EQ(ab.getBitBoardBlack(), black);
+    EXPECT_EQ(ab.getWhoIsToPlay(), 1);
+}
+
+/*
+ * Tests for perftDivide
+ */
+
+TEST(PerftDivide, SumsToPerft) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 4);
+
+    /* Act */
+    const auto divide = ab.perftDivide(3);
+    uint64_t total = 0;
+    for (const auto &count : divide)
+        total += count.second;
+
+    /* Assert */
+    EXPECT_EQ(divide.size(), ab.perft(1));
+    EXPECT_EQ(total, ab.perft(3));
+}
+
+TEST(PerftDivide, MovesAreDistinct) {
+    /* Arrange */
+    AlphaBeta ab;
+
+    /* Act */
+    const auto divide = ab.perftDivide(2);
+
+    /* Assert */
+    EXPECT_EQ(std::adjacent_find(divide.begin(), divide.end(),
+                                 [](const auto &a, const auto &b) { return a.first == b.first; }),
+              divide.end());
+}
+
+/*
+ * Tests for setFloodFillMoveGeneration
+ */
+
+TEST(SetFloodFillMoveGeneration, SameMovesAsBFS) {
+    for (int number_of_moves = 0; number_of_moves <= 10; ++number_of_moves) {
+        /* Arrange */
+        AlphaBeta ab;
+        playMiddleGame(&ab, number_of_moves);
+
+        /* Act */
+        ab.setFloodFillMoveGeneration(true);
+        const auto flood_fill = ab.perftDivide(2);
+        ab.setFloodFillMoveGeneration(false);
+        const auto bfs = ab.perftDivide(2);
+
+        /* Assert */
+        EXPECT_EQ(flood_fill, bfs) << "after " << number_of_moves << " moves";
+    }
+}
+
+TEST(SetFloodFillMoveGeneration, BFSPerft) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 9);
+
+    /* Act */
+    ab.setFloodFillMoveGeneration(false);
+
+    /* Assert */
+    EXPECT_FALSE(ab.getFloodFillMoveGeneration());
+    EXPECT_EQ(ab.perft(3), 475976);
+}
+
+/*
+ * Tests for setLateMoveReductionTable
+ */
+
+TEST(SetLateMoveReductionTable, FirstMovesAndShallowNodesAreNotReduced) {
+    /* Arrange */
+    AlphaBeta ab;
+
+    /* Act */
+    ab.setLateMoveReductionTable(4, 2, 1.0, 2.0);
+
+    /* Assert */
+    for (int depth = 0; depth < 4; ++depth)
+        EXPECT_EQ(ab.getLateMoveReduction(depth, 30), 0);
+    EXPECT_EQ(ab.getLateMoveReduction(10, 0), 0);
+    EXPECT_EQ(ab.getLateMoveReduction(10, 1), 0);
+    EXPECT_GT(ab.getLateMoveReduction(10, 2), 0);
+}
+
+TEST(SetLateMoveReductionTable, MovesAreSearchedAtLeastOnePly) {
+    /* Arrange */
+    AlphaBeta ab;
+
+    /* Act */
+    ab.setLateMoveReductionTable(0, 0, 10.0, 0.1);
+
+    /* Assert */
+    for (int depth = 0; depth <= MAX_SEARCH_DEPTH; ++depth) {
+        for (int index = 0; index < 100; ++index)
+            EXPECT_LE(ab.getLateMoveReduction(depth, index), std::max(depth - 2, 0));
+    }
+}
+
+TEST(SetLateMoveReductionTable, ReductionsGrowWithTheIndex) {
+    /* Arrange */
+    AlphaBeta ab;
+
+    /* Act */
+    /* Assert */
+    for (int index = 1; index < 100; ++index)
+        EXPECT_GE(ab.getLateMoveReduction(12, index), ab.getLateMoveReduction(12, index - 1));
+}
+
+/*
+ * Tests for setQuiescence
+ */
+
+TEST(SetQuiescence, DisabledQuiescenceVisitsNoNode) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+
+    /* Act */
+    ab.setQuiescence(false);
+    ab.getMove64(3);
+
+    /* Assert */
+    EXPECT_FALSE(ab.getQuiescence());
+    EXPECT_GT(ab.getNodeCount(), 0);
+    EXPECT_EQ(ab.getQuiescenceNodeCount(), 0);
+}
+
+TEST(SetQuiescence, QuiescenceNodesAreCountedSeparately) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+
+    /* Act */
+    ab.setQuiescence(true);
+    ab.getMove64(3);
+
+    /* Assert */
+    EXPECT_TRUE(ab.getQuiescence());
+    EXPECT_GT(ab.getQuiescenceNodeCount(), 0);
+}
+
+/*
+ * Tests for setQuiescenceDepth
+ */
+
+TEST(SetQuiescenceDepth, ZeroDepthGivesTheSameSearch) {
+    /* Arrange */
+    AlphaBeta with_quiescence;
+    AlphaBeta without_quiescence;
+    playMiddleGame(&with_quiescence, 8);
+    playMiddleGame(&without_quiescence, 8);
+
+    /* Act */
+    with_quiescence.setQuiescenceDepth(0);
+    without_quiescence.setQuiescence(false);
+
+    /* Assert */
+    EXPECT_EQ(with_quiescence.getQuiescenceDepth(), 0);
+    EXPECT_EQ(with_quiescence.getMove64(3), without_quiescence.getMove64(3));
+    EXPECT_EQ(with_quiescence.getNodeCount(), without_quiescence.getNodeCount());
+}
+
+/*
+ * Tests for startPondering
+ */
+
+TEST(StartPondering, NothingToPonderWithoutASearch) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+
+    /* Act */
+    /* Assert */
+    EXPECT_FALSE(ab.startPondering());
+    EXPECT_FALSE(ab.isPondering());
+    EXPECT_EQ(ab.getPonderReply(), 0);
+}
+
+TEST(StartPondering, PondersTheExpectedReply) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+    ab.moveWithoutVerification(ab.getMove64(3));
+
+    /* Act */
+    const bool started = ab.startPondering();
+
+    /* Assert */
+    ASSERT_TRUE(started);
+    EXPECT_TRUE(ab.isPondering());
+    MoveList possible_moves;
+    ab.availableMoves(possible_moves);
+    EXPECT_NE(std::find(possible_moves.begin(), possible_moves.end(), ab.getPonderReply()), possible_moves.end());
+    ab.stopPondering();
+}
+
+/*
+ * Tests for stopPondering
+ */
+
+TEST(StopPondering, PonderHit) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+    ab.moveWithoutVerification(ab.getMove64(3));
+    ASSERT_TRUE(ab.startPondering());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    /* Act */
+    ab.moveWithoutVerification(ab.getPonderReply());
+
+    /* Assert */
+    EXPECT_TRUE(ab.stopPondering());
+    EXPECT_FALSE(ab.isPondering());
+    EXPECT_NE(ab.getMove64Within(100), 0);
+}
+
+TEST(StopPondering, PonderHitOfADepthLimitedSearch) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+    ab.moveWithoutVerification(ab.getMove64(3));
+    ASSERT_TRUE(ab.startPondering());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ab.moveWithoutVerification(ab.getPonderReply());
+    MoveList possible_moves;
+    ab.availableMoves(possible_moves);
+
+    /* Act */
+    const uint_fast64_t move = ab.getMove64(2);
+
+    /* Assert */
+    /* The pondering went deeper than 2 plies: the move is found without searching any node. */
+    EXPECT_EQ(ab.getNodeCount(), 0);
+    EXPECT_NE(std::find(possible_moves.begin(), possible_moves.end(), move), possible_moves.end());
+}
+
+TEST(StopPondering, PonderMiss) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+    ab.moveWithoutVerification(ab.getMove64(3));
+    ASSERT_TRUE(ab.startPondering());
+    MoveList possible_moves;
+    ab.availableMoves(possible_moves);
+    const uint_fast64_t other_reply = possible_moves[0] == ab.getPonderReply() ? possible_moves[1]
+                                                                               : possible_moves[0];
+
+    /* Act */
+    ab.moveWithoutVerification(other_reply);
+
+    /* Assert */
+    EXPECT_FALSE(ab.stopPondering());
+    EXPECT_FALSE(ab.isPondering());
+}
+
+/*
+ * Tests for multiPVSearch
+ */
+
+TEST(MultiPVSearch, AllMovesGetAnExactValue) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+    MoveList possible_moves;
+    ab.availableMoves(possible_moves);
+
+    /* Act */
+    const std::vector<RootMove> root_moves = ab.multiPVSearch(3, -1);
+
+    /* Assert */
+    ASSERT_FALSE(root_moves.empty());
+    EXPECT_LE(root_moves.size(), possible_moves.size());
+    for (std::size_t i = 0; i < root_moves.size(); ++i) {
+        EXPECT_TRUE(root_moves[i].exact);
+        EXPECT_EQ(root_moves[i].pv.front(), root_moves[i].move);
+        if (i) {
+            EXPECT_LE(root_moves[i - 1].value, root_moves[i].value);
+        }
+    }
+}
+
+TEST(MultiPVSearch, BestMovesAreTheSameAsWithAllMoves) {
+    /* Arrange */
+    AlphaBeta all_moves;
+    AlphaBeta best_moves;
+    playMiddleGame(&all_moves, 8);
+    playMiddleGame(&best_moves, 8);
+
+    /* Act */
+    const std::vector<RootMove> expected = all_moves.multiPVSearch(3, -1);
+    const std::vector<RootMove> result   = best_moves.multiPVSearch(3, 3);
+
+    /* Assert */
+    ASSERT_EQ(result.size(), expected.size());
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(result[i].exact, i < 3);
+        if (i < 3) {
+            EXPECT_EQ(result[i].value, expected[i].value);
+        } else {
+            EXPECT_GE(result[i].value, result[2].value);
+        }
+    }
+}
+
+/*
+ * Tests for setMTDF
+ */
+
+TEST(SetMTDF, PlaysAMoveOfTheBestValue) {
+    /* Arrange */
+    AlphaBeta all_moves;
+    AlphaBeta mtdf;
+    playMiddleGame(&all_moves, 8);
+    playMiddleGame(&mtdf, 8);
+    const std::vector<RootMove> root_moves = all_moves.multiPVSearch(3, -1);
+
+    /* Act */
+    mtdf.setMTDF(true);
+    const uint_fast64_t move = mtdf.getMove64(3);
+
+    /* Assert */
+    EXPECT_TRUE(mtdf.getMTDF());
+    const auto played = std::find_if(root_moves.begin(), root_moves.end(),
+                                     [&move](const RootMove &root_move) { return root_move.move == move; });
+    ASSERT_NE(played, root_moves.end());
+    EXPECT_EQ(played->value, root_moves.front().value);
+}
+
+TEST(SetMTDF, TimedSearchPlaysALegalMove) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+    MoveList possible_moves;
+    ab.availableMoves(possible_moves);
+
+    /* Act */
+    ab.setMTDF(true);
+    const uint_fast64_t move = ab.getMove64Within(100);
+
+    /* Assert */
+    EXPECT_NE(std::find(possible_moves.begin(), possible_moves.end(), move), possible_moves.end());
+}
+
+/*
+ * Tests for setYoungBrothersWait
+ */
+
+TEST(SetYoungBrothersWait, PlaysALegalMove) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+    MoveList possible_moves;
+    ab.availableMoves(possible_moves);
+
+    /* Act */
+    ab.setNumberOfThreads(4);
+    ab.setYoungBrothersWait(true);
+    const uint_fast64_t move = ab.getMove64(4);
+
+    /* Assert */
+    EXPECT_TRUE(ab.getYoungBrothersWait());
+    EXPECT_NE(std::find(possible_moves.begin(), possible_moves.end(), move), possible_moves.end());
+}
+
+TEST(SetYoungBrothersWait, TimedSearchesPlayAGame) {
+    /* Arrange */
+    AlphaBeta ab;
+    ab.setNumberOfThreads(4);
+    ab.setYoungBrothersWait(true);
+
+    /* Act */
+    int plies = 0;
+    for (; ab.stateOfGame() == NotFinished && plies < 200; ++plies) {
+        MoveList possible_moves;
+        ab.availableMoves(possible_moves);
+        const uint_fast64_t move = ab.getMove64Within(20);
+        ASSERT_NE(std::find(possible_moves.begin(), possible_moves.end(), move), possible_moves.end());
+        ab.moveWithoutVerification(move);
+    }
+
+    /* Assert */
+    EXPECT_LT(plies, 200);
+}
+
+/*
+ * Tests for setNumberOfThreads
+ */
+
+TEST(SetNumberOfThreads, HelpersSearchARepeatedPosition) {
+#ifdef SEARCH_STATISTICS_DISABLED
+    GTEST_SKIP() << "The statistics are not counted";
+#endif
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+    /* Both players play a move and play it again, i.e., back: the position of the game is repeated. */
+    std::array<uint_fast64_t, 2> moves;
+    for (uint_fast64_t &move : moves) {
+        MoveList possible_moves;
+        ab.availableMoves(possible_moves);
+        move = possible_moves[0];
+        ab.moveWithoutVerification(move);
+    }
+    for (const uint_fast64_t &move : moves)
+        ab.moveWithoutVerification(move);
+
+    /* Act */
+    ab.setNumberOfThreads(2);
+    ab.getMove64(4);
+
+    /* Assert */
+    /* A helper which gives up at the root visits a single node per iteration. */
+    EXPECT_GT(ab.getSearchStatistics().helper_nodes, MAX_SEARCH_DEPTH);
+}
+
+/*
+ * Tests for search
+ */
+
+TEST(Search, SameMoveAsTheEngine) {
+    /* Arrange */
+    AlphaBeta game;
+    AlphaBeta engine;
+    AlphaBeta searcher;
+    playMiddleGame(&game, 8);
+    playMiddleGame(&engine, 8);
+    Limits limits;
+    limits.depth = 3;
+
+    /* Act */
+    const SearchResult result = searcher.search(game.getPosition(), limits);
+
+    /* Assert */
+    EXPECT_EQ(result.move, engine.getMove64(3));
+    EXPECT_EQ(result.depth, 3);
+    EXPECT_EQ(result.statistics.nodes, engine.getNodeCount());
+    /* The searcher has not played the moves of the game. */
+    EXPECT_EQ(searcher.getWhoIsToPlay(), 0);
+    EXPECT_EQ(searcher.getZobristHash(), AlphaBeta().getZobristHash());
+}
+
+TEST(Search, StartsCold) {
+    /* Arrange */
+    AlphaBeta warm;
+    AlphaBeta cold;
+    warm.setMTDF(true);
+    cold.setMTDF(true);
+    /* The engine knows the value of another position of the same player. Its transposition table is emptied. */
+    playMiddleGame(&warm, 8);
+    warm.getMove64(3);
+    warm.setTranspositionTableSize(warm.getTranspositionTableSize());
+    AlphaBeta game;
+    playMiddleGame(&game, 10);
+    Limits limits;
+    limits.depth = 3;
+
+    /* Act */
+    const SearchResult warm_result = warm.search(game.getPosition(), limits);
+    const SearchResult cold_result = cold.search(game.getPosition(), limits);
+
+    /* Assert */
+    EXPECT_EQ(warm_result.move, cold_result.move);
+    EXPECT_EQ(warm_result.value, cold_result.value);
+    EXPECT_EQ(warm_result.statistics.nodes, cold_result.statistics.nodes);
+}
+
+TEST(Search, ConcurrentSearches) {
+    /* Arrange */
+    AlphaBeta searcher;
+    std::vector<Position> positions;
+    for (int i = 1; i <= 4; ++i) {
+        AlphaBeta game;
+        playMiddleGame(&game, 2 * i);
+        positions.push_back(game.getPosition());
+    }
+    Limits limits;
+    limits.depth   = 4;
+    limits.time_ms = 50;
+
+    /* Act */
+    std::vector<SearchResult> results(positions.size());
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < positions.size(); ++i)
+        threads.emplace_back([&, i]() { results[i] = searcher.search(positions[i], limits); });
+    for (std::thread &thread : threads)
+        thread.join();
+
+    /* Assert */
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        AlphaBeta position;
+        position.setPosition(positions[i]);
+        MoveList possible_moves;
+        position.availableMoves(possible_moves);
+        EXPECT_NE(std::find(possible_moves.begin(), possible_moves.end(), results[i].move), possible_moves.end());
+        EXPECT_GE(results[i].depth, 1);
+        EXPECT_LE(results[i].depth, 4);
+    }
+}
+
+/*
+ * Tests for getSearchStatistics
+ */
+
+TEST(GetSearchStatistics, CountersAreConsistent) {
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+
+    /* Act */
+    ab.getMove64(4);
+    const SearchStatistics statistics = ab.getSearchStatistics();
+
+    /* Assert */
+    EXPECT_EQ(statistics.nodes, ab.getNodeCount());
+    EXPECT_EQ(statistics.quiescence_nodes, ab.getQuiescenceNodeCount());
+    EXPECT_LE(statistics.leaf_nodes, statistics.nodes);
+    EXPECT_LE(statistics.tt_hits, statistics.tt_probes);
+    EXPECT_LE(statistics.tt_cutoffs, statistics.tt_hits);
+    EXPECT_LE(statistics.first_move_cutoffs, statistics.cutoffs);
+    EXPECT_LE(statistics.firstMoveCutoffRate(), 1);
+#ifndef SEARCH_STATISTICS_DISABLED
+    EXPECT_GT(statistics.leaf_nodes, 0);
+    EXPECT_GT(statistics.tt_probes, 0);
+    EXPECT_GT(statistics.cutoffs, 0);
+    ASSERT_EQ(statistics.iterations.size(), 1);
+    EXPECT_EQ(statistics.iterations[0].depth, 4);
+    EXPECT_EQ(statistics.iterations[0].nodes, statistics.nodes);
+#endif
+}
+
+TEST(GetSearchStatistics, IterationsOfATimedSearch) {
+#ifdef SEARCH_STATISTICS_DISABLED
+    GTEST_SKIP() << "The statistics are not counted";
+#endif
+    /* Arrange */
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+
+    /* Act */
+    ab.getMove64Within(100);
+    const SearchStatistics statistics = ab.getSearchStatistics();
+
+    /* Assert */
+    ASSERT_FALSE(statistics.iterations.empty());
+    uint64_t nodes = 0;
+    for (std::size_t i = 0; i < statistics.iterations.size(); ++i) {
+        EXPECT_EQ(statistics.iterations[i].depth, i + 1);
+        EXPECT_GE(statistics.iterations[i].time_ms, 0);
+        nodes += statistics.iterations[i].nodes;
+    }
+    /* An interrupted iteration is not recorded. */
+    EXPECT_LE(nodes, statistics.nodes);
+    EXPECT_GT(statistics.effectiveBranchingFactor(), 1);
+}
+
+/*
+ * Tests for solveWin
+ */
+
+TEST(SolveWin, TheWinIsAsLongAsAnnounced) {
+    /* Arrange */
+    AlphaBeta ab;
+    int plies = 0;
+    while (ab.stateOfGame() == NotFinished && plies < 200) {
+        ab.moveWithoutVerification(ab.getMove64(2));
+        ++plies;
+        if (ab.solveWin(WIN_SOLVER_MAX_PLIES) > 0)
+            break;
+    }
+    ASSERT_GT(ab.getDistanceToWin(), 0);
+    const Player winner = ab.getWhoIsToPlay();
+    const int distance_to_win = ab.getDistanceToWin();
+
+    /* Act */
+    int remaining_plies = 0;
+    while (ab.stateOfGame() == NotFinished && remaining_plies <= distance_to_win) {
+        const uint_fast64_t move = ab.getMove64(2);
+        /* The win found by the solver gets shorter at each move of the winner. */
+        if (ab.getWhoIsToPlay() == winner) {
+            EXPECT_EQ(ab.getDistanceToWin(), distance_to_win - remaining_plies);
+        }
+        ab.moveWithoutVerification(move);
+        ++remaining_plies;
+    }
+
+    /* Assert */
+    EXPECT_EQ(ab.stateOfGame(), winner ? BlackWon : WhiteWon);
+    EXPECT_EQ(remaining_plies, distance_to_win);
+}
+
+/*
+ * Tests for setWinSolver
+ */
+
+TEST(SetWinSolver, DisabledSolverFindsNoWin) {
+    /* Arrange */
+    AlphaBeta ab;
+
+    /* Act */
+    ab.setWinSolver(false);
+
+    /* Assert */
+    EXPECT_FALSE(ab.getWinSolver());
+    for (int plies = 0; ab.stateOfGame() == NotFinished && plies < 200; ++plies) {
+        ab.moveWithoutVerification(ab.getMove64(2));
+        EXPECT_EQ(ab.getDistanceToWin(), -1);
+    }
+}
+
+/*
+ * Tests for quantizeWeights
+ */
+
+TEST(QuantizeWeights, DefaultWeightsAreExact) {
+    /* Arrange */
+    AlphaBeta ab;
+    const std::vector<double> win  = ab.getPlayerToWinValue();
+    const std::vector<double> lose = ab.getPlayerToLoseValue();
+
+    /* Act */
+    const weights_t win_scores  = AlphaBeta::quantizeWeights(win);
+    const weights_t lose_scores = AlphaBeta::quantizeWeights(lose);
+
+    /* Assert */
+    for (int i = 0; i < 64; ++i) {
+        EXPECT_DOUBLE_EQ(scoreToValue(win_scores[i]), win[i]);
+        EXPECT_DOUBLE_EQ(scoreToValue(lose_scores[i]), lose[i]);
+    }
+}
+
+TEST(QuantizeWeights, ClampsTheWeights) {
+    /* Arrange */
+    const std::vector<double> weights = {2.0, -3.0, 0.5};
+
+    /* Act */
+    const weights_t scores = AlphaBeta::quantizeWeights(weights);
+
+    /* Assert */
+    EXPECT_EQ(scores[0], SCORE_SCALE);
+    EXPECT_EQ(scores[1], -SCORE_SCALE);
+    EXPECT_EQ(scores[2], SCORE_SCALE / 2);
+    /* The missing weights are 0. */
+    for (int i = 3; i < 64; ++i)
+        EXPECT_EQ(scores[i], 0);
+}
+
+/*
+ * Tests for setPlayerToWinValue
+ */
+
+TEST(SetPlayerToWinValue, SameSearchAsTheConstructor) {
+    /* Arrange */
+    std::vector<double> win  = AlphaBeta().getPlayerToLoseValue();
+    std::vector<double> lose = AlphaBeta().getPlayerToWinValue();
+    std::reverse(win.begin(), win.end());
+    AlphaBeta constructed(win, lose);
+    AlphaBeta updated;
+    playMiddleGame(&constructed, 8);
+    playMiddleGame(&updated, 8);
+
+    /* Act */
+    updated.setPlayerToWinValue(win);
+    updated.setPlayerToLoseValue(lose);
+
+    /* Assert */
+    EXPECT_EQ(updated.getPlayerToWinValue(), win);
+    EXPECT_EQ(updated.getMove64(3), constructed.getMove64(3));
+    EXPECT_EQ(updated.getNodeCount(), constructed.getNodeCount());
+}
+
+TEST(SetPlayerToWinValue, HelpersUseTheNewWeights) {
+    /* Arrange */
+    const std::vector<double> zeros(64, 0.0);
+    AlphaBeta ab;
+    ab.setNumberOfThreads(4);
+    playMiddleGame(&ab, 8);
+    /* The helpers are created by the first search. */
+    ab.getMove64(4);
+
+    /* Act */
+    ab.setPlayerToWinValue(zeros);
+    ab.setPlayerToLoseValue(zeros);
+    ab.getMove64Within(200);
+    ab.setNumberOfThreads(1);
+    const std::vector<RootMove> root_moves = ab.multiPVSearch(3, -1);
+
+    /* Assert */
+    /* No position is worth anything but the draws: the values stored in the shared transposition table
+     * by the helpers are 0 or draws. */
+    ASSERT_FALSE(root_moves.empty());
+    for (const RootMove &root_move : root_moves)
+        EXPECT_TRUE(root_move.value == 0 || root_move.value == DRAW_SCORE) << root_move.value;
+}
+
+TEST(SetPlayerToWinValue, PonderingUsesTheNewWeights) {
+    /* Arrange */
+    const std::vector<double> zeros(64, 0.0);
+    AlphaBeta ab;
+    playMiddleGame(&ab, 8);
+    /* The ponder engine is created by the first pondering. */
+    ab.moveWithoutVerification(ab.getMove64(3));
+    ASSERT_TRUE(ab.startPondering());
+    ab.stopPondering();
+
+    /* Act */
+    ab.setPlayerToWinValue(zeros);
+    ab.setPlayerToLoseValue(zeros);
+    ab.moveWithoutVerification(ab.getMove64(3));
+    ASSERT_TRUE(ab.startPondering());
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ab.moveWithoutVerification(ab.getPonderReply());
+    ab.stopPondering();
+    const std::vector<RootMove> root_moves = ab.multiPVSearch(3, -1);
+
+    /* Assert */
+    /* The heuristic value computed by the ponder engine is 0 as well. */
+    ASSERT_FALSE(root_moves.empty());
+    for (const RootMove &root_move : root_moves)
+        EXPECT_TRUE(root_move.value == 0 || root_move.value == DRAW_SCORE) << root_move.value;
+}
+
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/*! \endcond */
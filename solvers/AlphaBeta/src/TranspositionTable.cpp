@@ -0,0 +1,175 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * \file TranspositionTable.cpp
+ * \brief Transposition table implementation.
+ *
+ * Implementation of the TranspositionTable Class which stores the results of previous searches.
+ *
+ */
+
+/* TranspositionTable.hpp */
+#include "TranspositionTable.hpp"
+
+/* C Libraries */
+#include <stdint.h>
+
+/* C++ Libraries */
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+/* Position of the fields in an entry. The value is stored on the 16 lowest bits. */
+#define DATA_DEPTH_SHIFT      (16)
+#define DATA_BOUND_SHIFT      (24)
+#define DATA_GENERATION_SHIFT (26)
+#define DATA_FROM_SHIFT       (32)
+#define DATA_TO_SHIFT         (38)
+#define DATA_KEY_SHIFT        (44)
+/* The generation is stored on 6 bits. */
+#define GENERATION_MASK (0x3F)
+
+TranspositionTable::TranspositionTable(const std::size_t &size_mb) : size_mb_(size_mb) {}
+
+void TranspositionTable::allocate() {
+    if (allocated_.load(std::memory_order_acquire))
+        return;
+
+    /* Another search may be allocating the table. */
+    std::lock_guard<std::mutex> lock(allocation_mutex_);
+    if (allocated_.load(std::memory_order_relaxed))
+        return;
+
+    /* Use the largest power of two number of buckets that fits in the requested size. */
+    std::size_t number_of_buckets = 1;
+    while ((number_of_buckets << 1) * sizeof(Bucket) <= (size_mb_ << 20))
+        number_of_buckets <<= 1;
+
+    buckets_.reset(new Bucket[number_of_buckets]);
+    mask_ = number_of_buckets - 1;
+    clearEntries();
+    allocated_.store(true, std::memory_order_release);
+}
+
+void TranspositionTable::resize(const std::size_t &size_mb) {
+    size_mb_ = std::max(static_cast<std::size_t>(1), size_mb);
+    allocated_.store(false, std::memory_order_relaxed);
+    buckets_.reset();
+    mask_ = 0;
+}
+
+std::size_t TranspositionTable::getSizeMB() const {
+    return size_mb_;
+}
+
+void TranspositionTable::clear() {
+    if (!allocated_.load(std::memory_order_acquire)) {
+        allocate();
+        return;
+    }
+    clearEntries();
+}
+
+void TranspositionTable::clearEntries() {
+    for (uint64_t i = 0; i <= mask_; ++i) {
+        for (Entry &entry : buckets_[i].entries)
+            entry.store(0, std::memory_order_relaxed);
+    }
+}
+
+void TranspositionTable::newSearch() {
+    allocate();
+    generation_.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool TranspositionTable::probe(const uint_fast64_t &hash, Data *data) const {
+    /* Nothing has been stored yet. */
+    if (!allocated_.load(std::memory_order_acquire))
+        return false;
+
+    const Bucket &bucket = buckets_[hash & mask_];
+
+    for (const Entry &entry : bucket.entries) {
+        const uint64_t packed = entry.load(std::memory_order_relaxed);
+
+        /* Check that the entry is the one we are looking for. */
+        if (!packed || (packed >> DATA_KEY_SHIFT) != (hash >> DATA_KEY_SHIFT))
+            continue;
+
+        const int from = (packed >> DATA_FROM_SHIFT) & 63;
+        const int to   = (packed >> DATA_TO_SHIFT) & 63;
+
+        data->value = static_cast<int16_t>(packed & 0xFFFF);
+        data->depth = static_cast<uint8_t>(packed >> DATA_DEPTH_SHIFT);
+        data->bound = static_cast<Bound>((packed >> DATA_BOUND_SHIFT) & 3);
+        data->move  = from == to ? 0 : (static_cast<uint_fast64_t>(1) << from)
+                                       | (static_cast<uint_fast64_t>(1) << to);
+        return true;
+    }
+    return false;
+}
+
+void TranspositionTable::store(const uint_fast64_t &hash,
+                               const score_t &value,
+                               const int &depth,
+                               const Bound &bound,
+                               const uint_fast64_t &move) {
+    /* The table must have been prepared with newSearch or clear. */
+    if (!allocated_.load(std::memory_order_acquire))
+        return;
+    const int generation = generation_.load(std::memory_order_relaxed) & GENERATION_MASK;
+
+    Bucket &bucket = buckets_[hash & mask_];
+
+    /* Find the entry to replace:
+     *  - the entry of the same position if there is one,
+     *  - otherwise an empty entry,
+     *  - otherwise the entry with the lowest depth, older generations being replaced first. */
+    Entry *replaced = &bucket.entries[0];
+    int replaced_score = 1 << 16;
+    uint64_t replaced_data = 0;
+    for (Entry &entry : bucket.entries) {
+        const uint64_t packed = entry.load(std::memory_order_relaxed);
+
+        if (!packed || (packed >> DATA_KEY_SHIFT) == (hash >> DATA_KEY_SHIFT)) {
+            replaced = &entry;
+            replaced_data = packed;
+            break;
+        }
+
+        const int age = (generation - (packed >> DATA_GENERATION_SHIFT)) & GENERATION_MASK;
+        const int score = static_cast<int>((packed >> DATA_DEPTH_SHIFT) & 0xFF) - (age << 3);
+        if (score < replaced_score) {
+            replaced = &entry;
+            replaced_score = score;
+            replaced_data = packed;
+        }
+    }
+
+    /* Keep the best move of the previous entry of the same position if we do not know any. */
+    int from, to;
+    if (move) {
+        from = __builtin_ctzll(move);
+        to   = 63 - __builtin_clzll(move);
+    } else if (replaced_data && (replaced_data >> DATA_KEY_SHIFT) == (hash >> DATA_KEY_SHIFT)) {
+        from = (replaced_data >> DATA_FROM_SHIFT) & 63;
+        to   = (replaced_data >> DATA_TO_SHIFT) & 63;
+    } else {
+        from = to = 0;
+    }
+
+    /* Pack the content of the entry in a single word. The scores fit in 16 bits. */
+    const uint64_t packed =   static_cast<uint64_t>(static_cast<uint16_t>(value))
+                            | (static_cast<uint64_t>(depth & 0xFF) << DATA_DEPTH_SHIFT)
+                            | (static_cast<uint64_t>(bound) << DATA_BOUND_SHIFT)
+                            | (static_cast<uint64_t>(generation) << DATA_GENERATION_SHIFT)
+                            | (static_cast<uint64_t>(from) << DATA_FROM_SHIFT)
+                            | (static_cast<uint64_t>(to) << DATA_TO_SHIFT)
+                            | ((hash >> DATA_KEY_SHIFT) << DATA_KEY_SHIFT);
+
+    replaced->store(packed, std::memory_order_relaxed);
+}
@@ -18,11 +18,7 @@
 /* C++ libraries */
 #include <vector>
 #include <unordered_map>
-#include <fstream>
 #include <iomanip>
-#include <random>
-#include <chrono>
-#include <boost/unordered_map.hpp>
 /* The following pragma are used to removed deprecation warning from boost
  * header files. Using them avoid to remove this warning from the entire project.
  */
@@ -38,112 +34,10 @@ template <typename T> int sgn(T val) {
     return (T(0) < val) - (val < T(0));
 }
 
-std::array<std::pair<int, int>, 64> initUint64ToPair() {
-    std::array<std::pair<int, int>, 64> result;
-    for (int i = 0; i < 8; ++i) {
-        for (int j = 0; j < 8; ++j)
-            result[(i * 8) + j] = {i, j};
-    }
-    return result;
-}
-
-std::array<std::array<uint32_t, 8>, 8> initCantorPairing() {
-    std::array<std::array<uint32_t, 8>, 8> result ;
-    for (int i = 0; i < 8; ++i) {
-        for (int j = 0; j < 8; ++j)
-            result[i][j] = 1 << ((i + j) * (i + j + 1) / 2 + i);
-    }
-    return result;
-}
-
-std::array<std::array<uint_fast64_t, 8>, 8> initIntToUint64() {
-    std::array<std::array<uint_fast64_t, 8>, 8> result;
-    for (int i = 0; i < 8; ++i) {
-        for (int j = 0; j < 8; ++j)
-            result[i][j] = static_cast<uint_fast64_t>(1) << ((i * 8) + j);
-    }
-    return result;
-}
-
-std::array<std::vector<uint_fast64_t>, 64> initDirectNeighbours() {
-    std::array<std::vector<uint_fast64_t>, 64> result;
-
-    auto int_to_uint64_ = initIntToUint64();
-    std::vector<std::vector<int>> valid_lines = {{-1,  0}, {-1,  1}, {0 , -1},
-                                                 {0 ,  1}, {1 , -1}, {1 ,  0}};
-
-    for (int i = 0; i < 8; ++i) {
-        for (int j = 0; j < 8; ++j) {
-            for (const std::vector<int> &direction: valid_lines) {
-                if (i + direction[0] >= 0
-                    && j + direction[1] >= 0
-                    && i + direction[0] < 8
-                    && j + direction[1] < 8) {
-                    result[8*i + j].push_back(int_to_uint64_[i + direction[0]][j + direction[1]]);
-                }
-            }
-        }
-    }
-    return result;
-}
-
-std::array<std::vector<
-        std::vector<std::pair<std::pair<uint_fast64_t,
-        uint_fast64_t>, uint_fast64_t> > >, 64> initKNeighbours() {
-    std::array<std::vector<
-            std::vector<std::pair<std::pair<uint_fast64_t,
-            uint_fast64_t>, uint_fast64_t> > >, 64> result;
-    auto int_to_uint64_ = initIntToUint64();
-    std::vector<std::vector<int>> valid_lines = {{-1,  0}, {-1,  1}, {0 , -1},
-                                                 {0 ,  1}, {1 , -1}, {1 ,  0}};
-
-    /* Loops over all positions of the board. */
-    for (int i = 0; i < 8; ++i) {
-        for (int j = 0; j < 8; ++j) {
-            /* Loop of all directions for a given position. */
-            for (const std::vector<int> &direction: valid_lines) {
-                std::vector<std::pair<std::pair<uint_fast64_t, uint_fast64_t>, uint_fast64_t > > lines_dir;
-
-                /* Loop over all possible jump from a given position in a given direction. */
-                for (int k = 1;    i + direction[0] * (k << 1) < 8
-                                   && j + direction[1] * (k << 1) < 8
-                                   && i + direction[0] * (k << 1) >= 0
-                                   && j + direction[1] * (k << 1) >= 0; ++k) {
-                    uint_fast64_t line = static_cast<uint_fast64_t>(0);
-                    for (int l = 1; l < k; ++l) {
-                        line |= (int_to_uint64_[i + direction[0] * (k - l)][j + direction[1] * (k - l)]);
-                        line |= (int_to_uint64_[i + direction[0] * (k + l)][j + direction[1] * (k + l)]);
-                    }
-                    line |= (int_to_uint64_[i + direction[0] * (k << 1)][j + direction[1] * (k << 1)]);
-
-                    if (line) {
-                        lines_dir.push_back({
-                                                    {int_to_uint64_[i + direction[0]*k][j + direction[1]*k],
-                                                     int_to_uint64_[i + direction[0] * (k << 1)][j + direction[1] * (k << 1)]},
-                                                    line
-                                            });
-                    }
-                }
-                result[8*i + j].push_back(lines_dir);
-            }
-        }
-    }
-    return result;
-};
-
-ChineseCheckers::ChineseCheckers() : uint64_to_pair_(initUint64ToPair()),
-                                     cantor_pairing_(initCantorPairing()),
-                                     int_to_uint64_(initIntToUint64()),
-                                     direct_neighbours_(initDirectNeighbours()),
-                                     k_neighbours_(initKNeighbours()),
-                                     illegal_positions_(loadIllegalPositions()) {
-    /* Compute the k-neighbours for each pawn position (ie, positions accessible by a jump). */
-    int i, j, s = 0;
-
+ChineseCheckers::ChineseCheckers() : zobrist_keys_(SharedContext::get().getZobristKeys()),
+                                     illegal_positions_(SharedContext::get().getIllegalPositions()) {
     /* Set up the board. */
     newGame();
-    /* Generates Zobrist's keys. */
-    generateZobristKeys();
 }
 
 void ChineseCheckers::newGame() {
@@ -155,51 +49,41 @@ void ChineseCheckers::newGame() {
     who_is_to_play_ = 0;
 
     /* Initialize the history. */
-    number_of_times_seen_.clear();
     positions_seen_.clear();
-    /* A good game usually last between 20 and 30 moves. */
-    number_of_times_seen_.reserve(64);
-    positions_seen_.reserve(64);
-    number_of_times_seen_[zobrist_hash_] = 1;
-    positions_seen_.push_back(zobrist_hash_);
+    repetition_filter_.fill(0);
+    /* A good game usually last between 20 and 30 moves. The solvers push the positions they search on top of it. */
+    positions_seen_.reserve(256);
+    computeAndSetZobristHash();
+    pushPosition(zobrist_hash_);
 }
 
-void ChineseCheckers::generateZobristKeys() {
-    /* Get a seed from the system clock to seed the random number generator. */
-    unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
-    std::mt19937_64 mt(seed);
-
-    /* Generate a Zobrist key for each position on the board */
-    for (uint_fast64_t i = un_64_; i; i <<= 1) {
-        /* Both player have a different Zobrist's key for a given position. */
-        zobrist_keys_[0][i] = mt();
-        zobrist_keys_[1][i] = mt();
-    }
+void ChineseCheckers::setZobristSeed(const uint64_t &seed) {
+    /* The keys of the default seed are the shared ones. */
+    zobrist_keys_ = seed == ZOBRIST_SEED ? SharedContext::get().getZobristKeys()
+                                         : std::make_shared<const ZobristKeys>(seed);
 
-    /* Pre-compute the Zobrist key for each possible move between two positions on the board. */
-    for (int i = 0; i < 64; ++i) {
-        for (int j = 0; j < i; ++j){
-            /* Combine the Zobrist keys for the two positions to generate a key for the move. */
-            zobrist_keys_moves_[0][(un_64_ << i) | (un_64_ << j)] =
-                    zobrist_keys_[0][(un_64_ << i)] ^ zobrist_keys_[0][(un_64_ << j)];
-            zobrist_keys_moves_[1][(un_64_ << i) | (un_64_ << j)] =
-                    zobrist_keys_[1][(un_64_ << i)] ^ zobrist_keys_[1][(un_64_ << j)];
-        }
-    }
+    /* The hashes of the history were computed with the former keys. */
+    positions_seen_.clear();
+    repetition_filter_.fill(0);
+    computeAndSetZobristHash();
+    pushPosition(zobrist_hash_);
 }
 
 void ChineseCheckers::computeAndSetZobristHash() {
     /* Set the initial Zobrist hash. */
     zobrist_hash_ = 0xFFFFFFFFFFFFFFFF;
     /* Iterate over each possible position of the board. */
-    for (uint_fast64_t i = un_64_; i; i <<= 1) {
+    for (int i = 0; i < 64; ++i) {
         /* If there is a white pawn at the given position, XOR the current hash with the corresponding key. */
-        if (bit_boards_.White & i)
-            zobrist_hash_ ^= zobrist_keys_[0][i];
+        if (bit_boards_.White & (un_64_ << i))
+            zobrist_hash_ ^= zobrist_keys_->squares[0][i];
         /* If there is a Black pawn at the given position, XOR the current hash with the corresponding key. */
-        else if (bit_boards_.Black & i)
-            zobrist_hash_ ^= zobrist_keys_[1][i];
+        else if (bit_boards_.Black & (un_64_ << i))
+            zobrist_hash_ ^= zobrist_keys_->squares[1][i];
     }
+    /* XOR the key of the side to move. */
+    if (who_is_to_play_)
+        zobrist_hash_ ^= zobrist_keys_->black_to_play;
 }
 
 Result ChineseCheckers::stateOfGame() {
@@ -216,8 +100,7 @@ Result ChineseCheckers::stateOfGame() {
         return BlackWon;
 
     /* Check for a draw */
-    if (number_of_times_seen_[zobrist_hash_]
-        == MAX_NUMBER_OF_CYCLES_FOR_DRAW_)
+    if (numberOfTimesSeen() == MAX_NUMBER_OF_CYCLES_FOR_DRAW_)
         return Draw;
     return NotFinished;
 }
@@ -230,16 +113,57 @@ void ChineseCheckers::moveWithoutVerification(const uint_fast64_t &move) {
         bit_boards_.White ^= move;
 
     /* Update the hash. */
-    zobrist_hash_ ^= zobrist_keys_moves_[who_is_to_play_][move];
+    zobrist_hash_ ^= zobristMoveKey(who_is_to_play_, move);
+    /* Update the player who is to play next. */
+    who_is_to_play_ ^= 1;
+
+    /* Add the position to the history. */
+    pushPosition(zobrist_hash_);
+}
+
+void ChineseCheckers::undoMoveWithoutVerification(const uint_fast64_t &move) {
+    /* Remove the position from the history. */
+    popPosition();
+
     /* Update the player who is to play next. */
     who_is_to_play_ ^= 1;
+    /* Update the right board. */
+    if (who_is_to_play_)
+        bit_boards_.Black ^= move;
+    else
+        bit_boards_.White ^= move;
+
+    /* Update the hash. */
+    zobrist_hash_ ^= zobristMoveKey(who_is_to_play_, move);
+}
+
+bool ChineseCheckers::isRepetition() const {
+    const uint64_t hash = positions_seen_.back();
+    /* The position is the only one of its slot. */
+    if (repetition_filter_[hash & (REPETITION_FILTER_SIZE - 1)] < 2)
+        return false;
 
-    /* Increase the count of the current position. */
-    ++number_of_times_seen_[zobrist_hash_];
-    if (std::find(positions_seen_.begin(), positions_seen_.end(), zobrist_hash_)
-            == positions_seen_.end())
-        positions_seen_.push_back(zobrist_hash_);
+    /* Only the positions with the same player to play can be the same. */
+    for (int i = static_cast<int>(positions_seen_.size()) - 3; i >= 0; i -= 2) {
+        if (positions_seen_[i] == hash)
+            return true;
+    }
+    return false;
+}
 
+int ChineseCheckers::numberOfTimesSeen() const {
+    const uint64_t hash = positions_seen_.back();
+    /* The position is the only one of its slot. */
+    if (repetition_filter_[hash & (REPETITION_FILTER_SIZE - 1)] < 2)
+        return 1;
+
+    /* Only the positions with the same player to play can be the same. */
+    int result = 1;
+    for (int i = static_cast<int>(positions_seen_.size()) - 3; i >= 0; i -= 2) {
+        if (positions_seen_[i] == hash)
+            ++result;
+    }
+    return result;
 }
 
 bool ChineseCheckers::move(const Player &player,
@@ -303,18 +227,15 @@ bool ChineseCheckers::move(const Player &player,
     }
 
     /* Update the Zobrist hash with the current move. */
-    zobrist_hash_ ^= zobrist_keys_moves_[who_is_to_play_][
-            (un_64_ << (list_moves[  0][0]*8 + list_moves[  0][1]))
-            | (un_64_ << (list_moves[n-1][0]*8 + list_moves[n-1][1]))];
+    zobrist_hash_ ^= zobristMoveKey(who_is_to_play_,
+                                    int_to_uint64_[list_moves[  0][0]][list_moves[  0][1]]
+                                    | int_to_uint64_[list_moves[n-1][0]][list_moves[n-1][1]]);
 
     /* Switch to the other player's turn. */
     who_is_to_play_ ^= 1;
 
-    /* Increase the count of the current position. */
-    ++number_of_times_seen_[zobrist_hash_];
-    if (std::find(positions_seen_.begin(), positions_seen_.end(), zobrist_hash_)
-        == positions_seen_.end())
-        positions_seen_.push_back(zobrist_hash_);
+    /* Add the position to the history. */
+    pushPosition(zobrist_hash_);
 
     return true;
 }
@@ -356,7 +277,7 @@ MoveType ChineseCheckers::elementaryMove(const PositionType &original_position,
         return notJump;
 
     /* Compute the direction of the move. */
-    std::vector<int> direction = {sgn(c - a), sgn(d - b)};
+    const std::array<int, 2> direction = {sgn(c - a), sgn(d - b)};
 
     /* Compute the position of the pawn jump over. */
     int mid;
@@ -385,25 +306,6 @@ MoveType ChineseCheckers::elementaryMove(const PositionType &original_position,
     return Jump;
 }
 
-boost::unordered_map<uint32_t, bool> ChineseCheckers::loadIllegalPositions() const {
-    boost::unordered_map<uint32_t, bool> result;
-    std::ifstream inFile("./raw_data/illegal_moves.dat");
-    /* Iterate through the file and load each element through the file. */
-    std::string line;
-    uint32_t hash;
-
-    while (std::getline(inFile, line)) {
-        std::istringstream ss(line);
-        ss >> std::hex >> hash;
-
-        result[hash] = true;
-    }
-    /* Close the file. */
-    inFile.close();
-
-    return result;
-}
-
 int ChineseCheckers::cantorPairingFunction(const int &x, const int &y) const {
     return (x + y) * (x + y + 1) / 2 + x;
 }
@@ -422,7 +324,7 @@ bool ChineseCheckers::isPositionIllegal() const {
         }
     }
 
-    if (illegal_positions_.find(code) != illegal_positions_.end()) {
+    if (illegal_positions_->contains(code)) {
        /* Full test. */
         for (i = 7; i > 1; --i) {
             for (j = 7; j > 8 - i; --j) {
@@ -435,7 +337,7 @@ bool ChineseCheckers::isPositionIllegal() const {
                      *  either the piece can move, therefore the bit is set to 0,
                      *  or it cannot move, therefore the bit is set to 1. */
                     code |= cantor_pairing_[i][j];
-                    for (const std::vector<int> &direction : valid_lines_illegal) {
+                    for (const auto &direction : valid_lines_illegal) {
                         if (elementaryMove(
                                 {7 - i, 7 - j},
                                 {7 - i - direction[0], 7 - j - direction[1]})
@@ -448,7 +350,7 @@ bool ChineseCheckers::isPositionIllegal() const {
                 /* If the location is unoccupied, the bit is set to 0. */
             }
         }
-        if (illegal_positions_.find(code) != illegal_positions_.end())
+        if (illegal_positions_->contains(code))
             return true;
     }
 
@@ -464,7 +366,7 @@ bool ChineseCheckers::isPositionIllegal() const {
         }
     }
 
-    if (illegal_positions_.find(code) != illegal_positions_.end()) {
+    if (illegal_positions_->contains(code)) {
         /* Full test. */
         for (i = 0; i < 6; ++i) {
             for (j = 0; j < 6 - i; ++j) {
@@ -477,7 +379,7 @@ bool ChineseCheckers::isPositionIllegal() const {
                      *  either the piece can move, therefore the bit is set to 0,
                      *  or it cannot move, therefore the bit is set to 1. */
                     code |= cantor_pairing_[i][j];
-                    for (const std::vector<int> &direction : valid_lines_illegal) {
+                    for (const auto &direction : valid_lines_illegal) {
                         if (elementaryMove({i, j}, {i + direction[0],
                                                           j + direction[1]})
                             != Illegal) {
@@ -490,7 +392,7 @@ bool ChineseCheckers::isPositionIllegal() const {
             }
         }
     }
-    return illegal_positions_.find(code) != illegal_positions_.end();
+    return illegal_positions_->contains(code);
 }
 
 uint_fast64_t ChineseCheckers::getBitBoardWhite() const {
@@ -501,6 +403,28 @@ uint_fast64_t ChineseCheckers::getBitBoardBlack() const {
     return bit_boards_.Black;
 }
 
+uint64_t ChineseCheckers::getZobristHash() const {
+    return zobrist_hash_;
+}
+
+Position ChineseCheckers::getPosition() const {
+    return {bit_boards_, who_is_to_play_, positions_seen_};
+}
+
+void ChineseCheckers::setPosition(const Position &position) {
+    bit_boards_     = position.bit_boards;
+    who_is_to_play_ = position.who_is_to_play;
+    computeAndSetZobristHash();
+
+    /* Rebuild the history and its filter. */
+    positions_seen_.clear();
+    repetition_filter_.fill(0);
+    for (const uint64_t &hash : position.history)
+        pushPosition(hash);
+    if (positions_seen_.empty())
+        pushPosition(zobrist_hash_);
+}
+
 Player ChineseCheckers::getWhoIsToPlay() const {
     return who_is_to_play_;
 }
@@ -976,6 +976,109 @@ TEST(GetBitBoardBlack, IsCorrecltyChangedAfterTwoIllegalMoves) {
     EXPECT_EQ(expectedValue, obtainedValue);
 }
 
+/*
+ * Tests for getZobristHash()
+ */
+
+TEST(GetZobristHash, IsTheSameForTwoGames) {
+    /* Arrange */
+    ChineseCheckers cc1;
+    ChineseCheckers cc2;
+
+    /* Act */
+    cc1.move(0, {{3, 0}, {4, 0}});
+    cc2.move(0, {{3, 0}, {4, 0}});
+
+    /* Assert */
+    EXPECT_EQ(cc1.getZobristHash(), cc2.getZobristHash());
+}
+
+TEST(GetZobristHash, IsTheSameForATransposition) {
+    /* Arrange */
+    ChineseCheckers cc1;
+    ChineseCheckers cc2;
+
+    /* Act */
+    ASSERT_TRUE(cc1.move(0, {{3, 0}, {4, 0}}));
+    ASSERT_TRUE(cc1.move(1, {{4, 7}, {3, 7}}));
+    ASSERT_TRUE(cc1.move(0, {{2, 1}, {3, 1}}));
+    ASSERT_TRUE(cc2.move(0, {{2, 1}, {3, 1}}));
+    ASSERT_TRUE(cc2.move(1, {{4, 7}, {3, 7}}));
+    ASSERT_TRUE(cc2.move(0, {{3, 0}, {4, 0}}));
+
+    /* Assert */
+    EXPECT_EQ(cc1.getZobristHash(), cc2.getZobristHash());
+}
+
+TEST(GetZobristHash, IsUpdatedLikeItIsComputed) {
+    /* Arrange */
+    ChineseCheckers cc;
+
+    /* Act */
+    ASSERT_TRUE(cc.move(0, {{3, 0}, {4, 0}}));
+    ASSERT_TRUE(cc.move(1, {{4, 7}, {3, 7}}));
+    const uint64_t updatedHash = cc.getZobristHash();
+    /* Restarting the history recomputes the hash of the current position from scratch. */
+    cc.setZobristSeed(ZOBRIST_SEED);
+
+    /* Assert */
+    EXPECT_EQ(cc.getZobristHash(), updatedHash);
+}
+
+TEST(SetZobristSeed, ChangesTheHash) {
+    /* Arrange */
+    ChineseCheckers cc;
+    const uint64_t initialHash = cc.getZobristHash();
+
+    /* Act */
+    cc.setZobristSeed(ZOBRIST_SEED + 1);
+
+    /* Assert */
+    EXPECT_NE(cc.getZobristHash(), initialHash);
+}
+
+/*
+ * Tests for setPosition()
+ */
+
+TEST(SetPosition, GivesBackThePosition) {
+    /* Arrange */
+    ChineseCheckers cc1;
+    ChineseCheckers cc2;
+    ASSERT_TRUE(cc1.move(0, {{3, 0}, {4, 0}}));
+    ASSERT_TRUE(cc1.move(1, {{4, 7}, {3, 7}}));
+
+    /* Act */
+    cc2.setPosition(cc1.getPosition());
+
+    /* Assert */
+    EXPECT_EQ(cc2.getBitBoardWhite(), cc1.getBitBoardWhite());
+    EXPECT_EQ(cc2.getBitBoardBlack(), cc1.getBitBoardBlack());
+    EXPECT_EQ(cc2.getWhoIsToPlay(), cc1.getWhoIsToPlay());
+    EXPECT_EQ(cc2.getZobristHash(), cc1.getZobristHash());
+    EXPECT_EQ(cc2.getPosition().history, cc1.getPosition().history);
+}
+
+TEST(SetPosition, KeepsTheHistoryOfTheDraws) {
+    /* Arrange */
+    ChineseCheckers cc1;
+    ChineseCheckers cc2;
+    /* The initial position is seen for the third time after the last move. */
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_TRUE(cc1.move(0, {{3, 0}, {4, 0}}));
+        ASSERT_TRUE(cc1.move(1, {{4, 7}, {3, 7}}));
+        ASSERT_TRUE(cc1.move(0, {{4, 0}, {3, 0}}));
+        ASSERT_TRUE(cc1.move(1, {{3, 7}, {4, 7}}));
+    }
+
+    /* Act */
+    cc2.setPosition(cc1.getPosition());
+
+    /* Assert */
+    EXPECT_EQ(cc1.stateOfGame(), Draw);
+    EXPECT_EQ(cc2.stateOfGame(), Draw);
+}
+
 /*
  * Tests for getWhoIsToPlay()
  */
@@ -1176,6 +1279,58 @@ TEST(IllegalPositions, IllegalWithNaiveWhite) {
 }
 
 
+/*
+ * Tests for IllegalPositions
+ */
+
+TEST(IllegalPositionsContains, BinaryFileMatchesTextFile) {
+    /* Arrange */
+    const IllegalPositions binary;
+    const IllegalPositions text("");
+
+    /* Act */
+    uint32_t differences = 0, illegal = 0;
+    for (uint32_t code = 0; !(code >> ILLEGAL_POSITIONS_CODE_BITS); ++code) {
+        differences += binary.contains(code) != text.contains(code);
+        illegal     += text.contains(code);
+    }
+
+    /* Assert */
+    EXPECT_TRUE(binary.isMapped());
+    EXPECT_FALSE(text.isMapped());
+    EXPECT_EQ(differences, 0);
+    EXPECT_EQ(illegal, 339041);
+}
+
+TEST(IllegalPositionsContains, LargeCodesAreNotIllegal) {
+    /* Arrange */
+    const IllegalPositions illegal_positions;
+
+    /* Act */
+    /* Assert */
+    EXPECT_FALSE(illegal_positions.contains(static_cast<uint32_t>(1) << ILLEGAL_POSITIONS_CODE_BITS));
+    EXPECT_FALSE(illegal_positions.contains(0xFFFFFFFF));
+}
+
+
+/*
+ * Tests for SharedContext
+ */
+
+TEST(SharedContextGet, IsBuiltOnce) {
+    /* Arrange */
+    ChineseCheckers cc;
+
+    /* Act */
+    const SharedContext &context = SharedContext::get();
+
+    /* Assert */
+    EXPECT_EQ(&context, &SharedContext::get());
+    EXPECT_EQ(context.getIllegalPositions(), SharedContext::get().getIllegalPositions());
+    EXPECT_EQ(context.getZobristKeys(), SharedContext::get().getZobristKeys());
+}
+
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
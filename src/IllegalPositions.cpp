@@ -0,0 +1,91 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * \file IllegalPositions.cpp
+ * \brief Illegal positions implementation.
+ *
+ * Implementation of the IllegalPositions Class which stores the codes of the illegal positions in a bitset.
+ *
+ */
+
+/* IllegalPositions.hpp */
+#include "IllegalPositions.hpp"
+
+/* C Libraries */
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* C++ Libraries */
+#include <string>
+#include <vector>
+#include <fstream>
+
+/* The size of the bitset in bytes. */
+#define ILLEGAL_POSITIONS_BYTES (ILLEGAL_POSITIONS_WORDS * sizeof(uint64_t))
+
+IllegalPositions::IllegalPositions(const std::string &binary_file_name,
+                                   const std::string &text_file_name) {
+    if (!mapBinary(binary_file_name))
+        loadText(text_file_name);
+}
+
+IllegalPositions::~IllegalPositions() {
+    if (mapping_)
+        munmap(mapping_, ILLEGAL_POSITIONS_BYTES);
+}
+
+bool IllegalPositions::mapBinary(const std::string &file_name) {
+    const int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    /* A file of the wrong size was not built by saveBinary. */
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) || static_cast<std::size_t>(file_stat.st_size) != ILLEGAL_POSITIONS_BYTES) {
+        close(fd);
+        return false;
+    }
+
+    void *mapping = mmap(nullptr, ILLEGAL_POSITIONS_BYTES, PROT_READ, MAP_SHARED, fd, 0);
+    /* The mapping stays valid once the file is closed. */
+    close(fd);
+    if (mapping == MAP_FAILED)
+        return false;
+
+    mapping_ = mapping;
+    bits_    = static_cast<const uint64_t *>(mapping);
+    return true;
+}
+
+void IllegalPositions::loadText(const std::string &file_name) {
+    bits_storage_.assign(ILLEGAL_POSITIONS_WORDS, 0);
+    bits_ = bits_storage_.data();
+
+    std::ifstream inFile(file_name);
+    /* Iterate through the file and load each element through the file. */
+    uint32_t code;
+    while (inFile >> std::hex >> code) {
+        if (!(code >> ILLEGAL_POSITIONS_CODE_BITS))
+            bits_storage_[code >> 6] |= static_cast<uint64_t>(1) << (code & 63);
+    }
+    /* Close the file. */
+    inFile.close();
+}
+
+bool IllegalPositions::isMapped() const {
+    return mapping_ != nullptr;
+}
+
+bool IllegalPositions::saveBinary(const std::string &file_name) const {
+    std::ofstream outFile(file_name, std::ios::binary | std::ios::trunc);
+    outFile.write(reinterpret_cast<const char *>(bits_), ILLEGAL_POSITIONS_BYTES);
+    outFile.close();
+    return static_cast<bool>(outFile);
+}
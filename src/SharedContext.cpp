@@ -0,0 +1,39 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * \file SharedContext.cpp
+ * \brief Shared context implementation.
+ *
+ * Implementation of the SharedContext Class which stores the immutable data shared by all the games of a process.
+ *
+ */
+
+/* SharedContext.hpp */
+#include "SharedContext.hpp"
+
+/* C++ Libraries */
+#include <memory>
+
+/* Other */
+#include "Types.hpp"
+
+SharedContext::SharedContext() : illegal_positions_(std::make_shared<const IllegalPositions>()),
+                                 zobrist_keys_(std::make_shared<const ZobristKeys>(ZOBRIST_SEED)) {}
+
+const SharedContext &SharedContext::get() {
+    /* The initialization of a static local variable is thread-safe. */
+    static const SharedContext context;
+    return context;
+}
+
+const std::shared_ptr<const IllegalPositions> &SharedContext::getIllegalPositions() const {
+    return illegal_positions_;
+}
+
+const std::shared_ptr<const ZobristKeys> &SharedContext::getZobristKeys() const {
+    return zobrist_keys_;
+}
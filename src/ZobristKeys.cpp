@@ -0,0 +1,35 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * \file ZobristKeys.cpp
+ * \brief Zobrist keys implementation.
+ *
+ * Implementation of the ZobristKeys structure which stores the random keys used to hash the positions.
+ *
+ */
+
+/* ZobristKeys.hpp */
+#include "ZobristKeys.hpp"
+
+/* C Libraries */
+#include <stdint.h>
+
+/* C++ Libraries */
+#include <random>
+
+ZobristKeys::ZobristKeys(const uint64_t &seed) {
+    std::mt19937_64 mt(seed);
+
+    /* Generate a Zobrist key for each position on the board */
+    for (int i = 0; i < 64; ++i) {
+        /* Both player have a different Zobrist's key for a given position. */
+        squares[0][i] = mt();
+        squares[1][i] = mt();
+    }
+    /* The same grid with a different player to play is a different position. */
+    black_to_play = mt();
+}
@@ -0,0 +1,41 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * \file illegal_positions_packer.cpp
+ * \brief
+ *
+ * This program is run by the build to turn the text list of the illegal positions into the bitset
+ * mapped by IllegalPositions.
+ * Usage: Illegal_positions_packer [illegal_moves.dat illegal_positions.bin]
+ *
+ */
+
+/* C++ libraries */
+#include <iostream>
+#include <string>
+#include <fstream>
+
+/* Other */
+#include "IllegalPositions.hpp"
+
+int main(int argc, char *argv[]) {
+    const std::string text_file_name   = argc > 2 ? argv[1] : ILLEGAL_POSITIONS_TEXT_FILE;
+    const std::string binary_file_name = argc > 2 ? argv[2] : ILLEGAL_POSITIONS_BINARY_FILE;
+
+    if (!std::ifstream(text_file_name)) {
+        std::cerr << "Could not read " << text_file_name << "\n";
+        return 1;
+    }
+
+    /* No binary file is given so that the text file is always the one read. */
+    const IllegalPositions illegal_positions("", text_file_name);
+    if (!illegal_positions.saveBinary(binary_file_name)) {
+        std::cerr << "Could not write " << binary_file_name << "\n";
+        return 1;
+    }
+    return 0;
+}
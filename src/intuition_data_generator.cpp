@@ -24,6 +24,7 @@
 #include <fstream>
 #include <iterator>
 #include <string>
+#include <iomanip>
 /* The following pragma are used to removed deprecation warning from boost
  * header files. Using them avoid to remove this warning from the entire project.
  */
@@ -47,7 +48,7 @@ int main() {
     for (int i = 0; i < NUMBER_OF_GAMES; ++i) {
         std::cout << std::setw(5) << 100 * static_cast<double>(i)/NUMBER_OF_GAMES << "%\n";
         IntuitionDataGenerator generator;
-        std::set<uint_fast64_t, decltype(generator.comp_move_)> moves(generator.comp_move_);
+        MoveList moves;
         generator.fillTransTable();
         srand(time(NULL));
         while (generator.stateOfGame() == NotFinished) {
@@ -63,10 +64,7 @@ int main() {
                 moves.clear();
                 generator.availableMoves(moves);
 
-                auto it = moves.begin();
-                std::advance(it, rand() % static_cast<int>(moves.size()));
-
-                generator.moveWithoutVerification(*it);
+                generator.moveWithoutVerification(moves[rand() % moves.size()]);
             }
 
             if (rand() % 10 <= 7) {
@@ -75,10 +73,7 @@ int main() {
                 moves.clear();
                 generator.availableMoves(moves);
 
-                auto it = moves.begin();
-                std::advance(it, rand() % static_cast<int>(moves.size()));
-
-                generator.moveWithoutVerification(*it);
+                generator.moveWithoutVerification(moves[rand() % moves.size()]);
             }
         }
     }
@@ -115,54 +110,20 @@ void IntuitionDataGenerator::saveVectorOfBitBoardsToFiles(
 
 std::pair<std::vector<bitBoards_t>, std::vector<double>>
                 IntuitionDataGenerator::evalAllMoves(int depth) {
-    maximizing_player_ = who_is_to_play_;
-    fullDepth_         = depth;
-
-    std::set<uint_fast64_t, decltype(comp_move_)> moves(comp_move_);
-    availableMoves(moves);
-
     std::vector<double> evals;
     std::vector<bitBoards_t> all_bit_boards;
-    double buff;
-    for (const uint_fast64_t &move : moves) {
-        transposition_table_.clear();
-        /* Apply the move */
-        this->moveWithoutVerification(move);
-        heuristic_value_   = heuristicValue();
+    /* All the moves are scored by a single search: they share the transposition table. */
+    for (const RootMove &root_move : multiPVSearch(depth, -1)) {
+        /* Compute the grid obtained after the move. */
+        bitBoards_t bb = bit_boards_;
+        who_is_to_play_ ? bb.Black ^= root_move.move : bb.White ^= root_move.move;
 
         /* Check if we already have informations about this position */
-        if (transposition_table_permanent_.find(bit_boards_)
-                != transposition_table_permanent_.end()) {
-            --number_of_times_seen_[zobrist_hash_];
-            who_is_to_play_ ^= 1;
-            who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
-            zobrist_hash_ ^= zobrist_keys_moves_[who_is_to_play_][move];
+        if (transposition_table_permanent_.find(bb) != transposition_table_permanent_.end())
             continue;
-        }
-
-        if (this->isPositionIllegal()) {
-            /* cancel the move */
-            who_is_to_play_ ^= 1;
-            who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
-            zobrist_hash_ ^= zobrist_keys_moves_[who_is_to_play_][move];
-            continue;
-        }
 
-        /* evaluate the move */
-        buff = AlphaBetaEval(depth - 1,
-                             -20,
-                             20,
-                             true,
-                             false,
-                             zobrist_hash_);
-
-        all_bit_boards.push_back(bit_boards_);
-        evals.push_back(buff);
-
-        /* cancel the move */
-        who_is_to_play_ ^= 1;
-        who_is_to_play_ ? bit_boards_.Black ^= move : bit_boards_.White ^= move;
-        zobrist_hash_ ^= zobrist_keys_moves_[who_is_to_play_][move];
+        all_bit_boards.push_back(bb);
+        evals.push_back(scoreToValue(root_move.value));
     }
 
     return std::make_pair(all_bit_boards, evals);
@@ -40,7 +40,6 @@
 int main() {
     auto black_openings = []() {
         OpeningsGenerator og_black;
-        og_black.loadOpenings();
 
         std::ofstream outFile("./raw_data/openings_black.dat", std::ios_base::app);
         og_black.generateOpeningsBlack(MAX_TREE_DEPTH + 1, &outFile);
@@ -48,7 +47,6 @@ int main() {
     };
     auto white_openings = []() {
         OpeningsGenerator og_white;
-        og_white.loadOpenings();
 
         std::ofstream outFile("./raw_data/openings_white.dat", std::ios_base::app);
         og_white.generateOpeningsWhite(MAX_TREE_DEPTH, &outFile);
@@ -69,9 +67,9 @@ void OpeningsGenerator::generateOpeningsWhite(int depth, std::ofstream *outFile)
         return;
 
     uint_fast64_t move_0;
-    if (!(this->opening_[0].find(bit_boards_) != opening_[0].end())) {
+    if (!((*openings_)[0].find(bit_boards_) != (*openings_)[0].end())) {
         move_0 = getMove64(DEPTH_ALPHABETA);
-        opening_[0][bit_boards_] = move_0;
+        (*openings_)[0][bit_boards_] = move_0;
         *outFile << std::hex
                  << bit_boards_.White
                  << " "
@@ -82,32 +80,26 @@ void OpeningsGenerator::generateOpeningsWhite(int depth, std::ofstream *outFile)
                  << move_0
                  << std::endl;
     } else {
-        move_0 = opening_[0][bit_boards_];
+        move_0 = (*openings_)[0][bit_boards_];
     }
     moveWithoutVerification(move_0);
 
-    std::cout << "White : " << this->opening_[0].size() << "\n";
-    std::set<uint_fast64_t, decltype(comp_move_)> moves_1(comp_move_);
+    std::cout << "White : " << (*openings_)[0].size() << "\n";
+    MoveList moves_1;
     availableMoves(moves_1);
 
-    int index = 0;
-    for (const auto &move_1 : moves_1) {
-        if(++index > TREE_WIDTH) break;
+    /* Only the TREE_WIDTH best moves are considered. */
+    for (int index = 0; index < moves_1.size() && index < static_cast<int>(TREE_WIDTH); ++index) {
+        const uint_fast64_t move_1 = moves_1.pickBest(index);
 
         moveWithoutVerification(move_1);
         if (!this->isPositionIllegal())
             generateOpeningsWhite(depth - 1, outFile);
 
-        --number_of_times_seen_[zobrist_hash_];
-        who_is_to_play_ = 1;
-        bit_boards_.Black ^= move_1;
-        zobrist_hash_ ^= zobrist_keys_moves_[1][move_1];
+        undoMoveWithoutVerification(move_1);
     }
 
-    --number_of_times_seen_[zobrist_hash_];
-    who_is_to_play_ ^= 1;
-    who_is_to_play_ ? bit_boards_.Black ^= move_0 : bit_boards_.White ^= move_0;
-    zobrist_hash_ ^= zobrist_keys_moves_[who_is_to_play_][move_0];
+    undoMoveWithoutVerification(move_0);
 }
 
 void OpeningsGenerator::generateOpeningsBlack(int depth, std::ofstream *outFile) {
@@ -116,9 +108,9 @@ void OpeningsGenerator::generateOpeningsBlack(int depth, std::ofstream *outFile)
 
     uint_fast64_t move_1;
     if (depth != MAX_TREE_DEPTH + 1) {
-        if (!(this->opening_[1].find(bit_boards_) != opening_[0].end())) {
+        if (!((*openings_)[1].find(bit_boards_) != (*openings_)[1].end())) {
             move_1 = this->getMove64(DEPTH_ALPHABETA);
-            this->opening_[1][bit_boards_] = move_1;
+            (*openings_)[1][bit_boards_] = move_1;
             *outFile << std::hex
                      << bit_boards_.White
                      << " "
@@ -129,36 +121,30 @@ void OpeningsGenerator::generateOpeningsBlack(int depth, std::ofstream *outFile)
                      << move_1
                      << std::endl;
         } else {
-            move_1 = this->opening_[1][bit_boards_];
+            move_1 = (*openings_)[1][bit_boards_];
         }
 
         this->moveWithoutVerification(move_1);
     }
 
-    std::cout << "Black : " << this->opening_[1].size() << "\n";
+    std::cout << "Black : " << (*openings_)[1].size() << "\n";
 
-    std::set<uint_fast64_t, decltype(comp_move_)> moves_0(comp_move_);
+    MoveList moves_0;
     this->availableMoves(moves_0);
 
-    int index = 0;
-    for (const auto &move_0 : moves_0) {
-        if(++index > TREE_WIDTH) break;
+    /* Only the TREE_WIDTH best moves are considered. */
+    for (int index = 0; index < moves_0.size() && index < static_cast<int>(TREE_WIDTH); ++index) {
+        const uint_fast64_t move_0 = moves_0.pickBest(index);
 
         this->moveWithoutVerification(move_0);
 
         if (!this->isPositionIllegal())
             this->generateOpeningsBlack(depth - 1, outFile);
 
-        --number_of_times_seen_[zobrist_hash_];
-        who_is_to_play_ = 0;
-        bit_boards_.White ^= move_0;
-        zobrist_hash_ ^= zobrist_keys_moves_[0][move_0];
+        this->undoMoveWithoutVerification(move_0);
     }
 
     if (depth != MAX_TREE_DEPTH + 1) {
-        --number_of_times_seen_[zobrist_hash_];
-        who_is_to_play_ ^= 1;
-        who_is_to_play_ ? bit_boards_.Black ^= move_1 : bit_boards_.White ^= move_1;
-        zobrist_hash_ ^= zobrist_keys_moves_[who_is_to_play_][move_1];
+        this->undoMoveWithoutVerification(move_1);
     }
 }
\ No newline at end of file
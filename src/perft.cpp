@@ -0,0 +1,88 @@
+/*
+ * This file is part of ChineseCheckers which is released under GNU General Public License v3.0.
+ * See file LICENSE or go to https://github.com/alexicanesse/ChineseCheckers/blob/main/LICENSE for full license details.
+ * Copyright 2022 - ENS de Lyon
+ */
+
+/**
+ * \file perft.cpp
+ * \brief
+ *
+ * This class is used to check and to time the move generation.
+ * Usage: Perft depth [divide] [bfs] [white black player]
+ * where bfs uses the reference BFS generator of the jumps instead of the flood fill,
+ * and white and black are the bit boards of the position in hexadecimal and player is 0 (White) or 1 (Black).
+ *
+ */
+
+/* perft.hpp */
+#include "perft.hpp"
+
+/* C libraries */
+#include <stdint.h>
+#include <stdlib.h>
+
+/* C++ libraries */
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <vector>
+#include <utility>
+
+/* Other */
+#include "Types.hpp"
+#include "AlphaBeta.hpp"
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " depth [divide] [bfs] [white black player]\n";
+        return 1;
+    }
+
+    const int depth = atoi(argv[1]);
+    int arg = 2;
+    const bool divide = argc > arg && std::string(argv[arg]) == "divide";
+    if (divide)
+        ++arg;
+    /* The jumps are generated by the reference BFS generator instead of the flood fill. */
+    const bool bfs = argc > arg && std::string(argv[arg]) == "bfs";
+    if (bfs)
+        ++arg;
+
+    Perft perft;
+    perft.setFloodFillMoveGeneration(!bfs);
+    if (argc >= arg + 3) {
+        bitBoards_t bb;
+        bb.White = std::stoull(argv[arg], nullptr, 16);
+        bb.Black = std::stoull(argv[arg + 1], nullptr, 16);
+        perft.setPosition(bb, atoi(argv[arg + 2]));
+    }
+
+    perft.run(depth, divide);
+    return 0;
+}
+
+void Perft::setPosition(const bitBoards_t &bb, const Player &player) {
+    /* Start a new history from this position. */
+    ChineseCheckers::setPosition({bb, player, {}});
+}
+
+void Perft::run(const int &depth, const bool &divide) {
+    const auto start = std::chrono::steady_clock::now();
+
+    uint64_t nodes = 0;
+    if (divide) {
+        for (const auto &count : perftDivide(depth)) {
+            std::cout << std::hex << count.first << std::dec << ": " << count.second << "\n";
+            nodes += count.second;
+        }
+    } else {
+        nodes = perft(depth);
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Depth " << depth << ": " << nodes << " nodes in "
+              << std::fixed << std::setprecision(3) << seconds << " s ("
+              << std::setprecision(0) << (seconds > 0 ? nodes / seconds : 0) << " nodes/s)\n";
+}
@@ -513,32 +513,24 @@ void GamePlayer::set_depth(const int &depth_) {
 double GamePlayer::playGame() {
     int remaining_moves = MAX_NUM_MOVES;
 
-    white_player.newGame();
-    black_player.newGame();
+    /* The only state of the game: the players search it without playing the moves themselves. */
+    ChineseCheckers game;
+    Limits limits;
+    limits.depth = this->depth;
 
-    uint_fast64_t move;
-    while ((this->white_player.stateOfGame() == NotFinished)
+    while ((game.stateOfGame() == NotFinished)
             && (remaining_moves > 0)) {
-        move = white_player.getMove64(this->depth);
-        white_player.moveWithoutVerification(move);
-        black_player.moveWithoutVerification(move);
-        --remaining_moves;
-
-        if (white_player.stateOfGame() != NotFinished)
-            break;
-
-        move = black_player.getMove64(this->depth);
-        this->white_player.moveWithoutVerification(move);
-        this->black_player.moveWithoutVerification(move);
+        const AlphaBeta &player = game.getWhoIsToPlay() ? this->black_player : this->white_player;
+        game.moveWithoutVerification(player.search(game.getPosition(), limits).move);
         --remaining_moves;
     }
 
     double score = 0.0;
     // std::cout << " remaining moves: " << remaining_moves<< std::endl;
-    switch (white_player.stateOfGame()) {
+    switch (game.stateOfGame()) {
         case NotFinished:
-            score -= std::bitset<64>((white_player.getBitBoardWhite() | white_player.getBitBoardBlack()) & 0x000000000103070F).count();
-            score += std::bitset<64>((white_player.getBitBoardWhite() | white_player.getBitBoardBlack()) & 0xF0E0C08000000000).count();
+            score -= std::bitset<64>((game.getBitBoardWhite() | game.getBitBoardBlack()) & 0x000000000103070F).count();
+            score += std::bitset<64>((game.getBitBoardWhite() | game.getBitBoardBlack()) & 0xF0E0C08000000000).count();
             return score/20;
         break;
 